@@ -45,7 +45,9 @@
 #include <private/qv4function_p.h>
 #include <private/qv4objectproto_p.h>
 #include <private/qv4lookup_p.h>
+#include <private/qv4identifiertable_p.h>
 #include <private/qv4regexpobject_p.h>
+#include <private/qv4qobjectwrapper_p.h>
 
 #include <algorithm>
 
@@ -70,8 +72,13 @@ QV4::Function *CompilationUnit::linkToEngine(ExecutionEngine *engine)
     runtimeStrings = (QV4::SafeString *)malloc(data->stringTableSize * sizeof(QV4::SafeString));
     // memset the strings to 0 in case a GC run happens while we're within the loop below
     memset(runtimeStrings, 0, data->stringTableSize * sizeof(QV4::SafeString));
-    for (uint i = 0; i < data->stringTableSize; ++i)
-        runtimeStrings[i] = engine->newIdentifier(data->stringAt(i));
+    // Names like "width" or "parent" appear in almost every unit; resolve them against the
+    // engine's identifier table using the precomputed hash, so that only strings the engine
+    // has not seen yet are copied out of the unit.
+    for (uint i = 0; i < data->stringTableSize; ++i) {
+        const CompiledData::String *str = data->stringEntryAt(i);
+        runtimeStrings[i] = engine->identifierTable->insertString(str->unicode(), str->length(), str->hash);
+    }
 
     runtimeRegularExpressions = new QV4::SafeValue[data->regexpTableSize];
     // memset the regexps to 0 in case a GC run happens while we're within the loop below
@@ -143,6 +150,10 @@ void CompilationUnit::unlink()
     if (engine)
         engine->compilationUnits.erase(engine->compilationUnits.find(this));
     engine = 0;
+    if (runtimeLookups) {
+        for (uint i = 0; i < data->lookupTableSize; ++i)
+            QV4::QObjectWrapper::releaseLookup(runtimeLookups + i);
+    }
     if (ownsData)
         free(data);
     data = 0;
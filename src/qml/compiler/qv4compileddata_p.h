@@ -132,6 +132,9 @@ struct String
     QArrayData str;
     // uint16 strdata[]
 
+    const QChar *unicode() const { return static_cast<const QChar *>(str.data()); }
+    int length() const { return str.size; }
+
     static int calculateSize(const QString &str) {
         return (sizeof(String) + (str.length() + 1) * sizeof(quint16) + 7) & ~0x7;
     }
@@ -167,10 +170,14 @@ struct Unit
     qint32 indexOfRootFunction;
     quint32 sourceFileIndex;
 
-    QString stringAt(int idx) const {
+    const String *stringEntryAt(int idx) const {
         const uint *offsetTable = reinterpret_cast<const uint*>((reinterpret_cast<const char *>(this)) + offsetToStringTable);
         const uint offset = offsetTable[idx];
-        const String *str = reinterpret_cast<const String*>(reinterpret_cast<const char *>(this) + offset);
+        return reinterpret_cast<const String*>(reinterpret_cast<const char *>(this) + offset);
+    }
+
+    QString stringAt(int idx) const {
+        const String *str = stringEntryAt(idx);
         QStringDataPtr holder = { const_cast<QStringData *>(static_cast<const QStringData*>(&str->str)) };
         QString qstr(holder);
         if (flags & StaticData)
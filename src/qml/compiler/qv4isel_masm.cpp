@@ -974,7 +974,7 @@ void InstructionSelection::initClosure(V4IR::Closure *closure, V4IR::Temp *targe
 
 void InstructionSelection::getProperty(V4IR::Expr *base, const QString &name, V4IR::Temp *target)
 {
-    if (useFastLookups) {
+    if (useFastMemberLookups) {
         uint index = registerGetterLookup(name);
         generateLookupCall(target, index, qOffsetOf(QV4::Lookup, getter), Assembler::PointerToValue(base), Assembler::Void);
     } else {
@@ -992,7 +992,7 @@ void InstructionSelection::getQObjectProperty(V4IR::Expr *base, int propertyInde
 void InstructionSelection::setProperty(V4IR::Expr *source, V4IR::Expr *targetBase,
                                        const QString &targetName)
 {
-    if (useFastLookups) {
+    if (useFastMemberLookups) {
         uint index = registerSetterLookup(targetName);
         generateLookupCall(Assembler::Void, index, qOffsetOf(QV4::Lookup, setter),
                            Assembler::PointerToValue(targetBase),
@@ -484,7 +484,7 @@ void InstructionSelection::initClosure(V4IR::Closure *closure, V4IR::Temp *targe
 
 void InstructionSelection::getProperty(V4IR::Expr *base, const QString &name, V4IR::Temp *target)
 {
-    if (useFastLookups) {
+    if (useFastMemberLookups) {
         Instruction::GetLookup load;
         load.base = getParam(base);
         load.index = registerGetterLookup(name);
@@ -502,7 +502,7 @@ void InstructionSelection::getProperty(V4IR::Expr *base, const QString &name, V4
 void InstructionSelection::setProperty(V4IR::Expr *source, V4IR::Expr *targetBase,
                                        const QString &targetName)
 {
-    if (useFastLookups) {
+    if (useFastMemberLookups) {
         Instruction::SetLookup store;
         store.base = getParam(targetBase);
         store.index = registerSetterLookup(targetName);
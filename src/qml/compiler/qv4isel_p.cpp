@@ -61,6 +61,7 @@ using namespace QQmlJS::V4IR;
 
 EvalInstructionSelection::EvalInstructionSelection(QV4::ExecutableAllocator *execAllocator, Module *module, QV4::Compiler::JSUnitGenerator *jsGenerator)
     : useFastLookups(true)
+    , useFastMemberLookups(true)
     , executableAllocator(execAllocator)
     , irModule(module)
 {
@@ -69,7 +69,10 @@ public:
 
     QV4::CompiledData::CompilationUnit *compile(bool generateUnitData = true);
 
-    void setUseFastLookups(bool b) { useFastLookups = b; }
+    void setUseFastLookups(bool b) { useFastLookups = b; useFastMemberLookups = b; }
+    // Member lookups do not depend on the scope chain, so they can stay enabled
+    // where lookups of global names have to be turned off, e.g. for QML code.
+    void setUseFastMemberLookups(bool b) { useFastMemberLookups = b; }
 
     int registerString(const QString &str) { return jsGenerator->registerString(str); }
     uint registerGetterLookup(const QString &name) { return jsGenerator->registerGetterLookup(name); }
@@ -84,6 +87,7 @@ protected:
     virtual QV4::CompiledData::CompilationUnit *backendCompileStep() = 0;
 
     bool useFastLookups;
+    bool useFastMemberLookups;
     QV4::ExecutableAllocator *executableAllocator;
     QV4::Compiler::JSUnitGenerator *jsGenerator;
     QScopedPointer<QV4::Compiler::JSUnitGenerator> ownJSGenerator;
@@ -72,6 +72,8 @@
 
 #include "qv4isel_moth_p.h"
 
+#include <QtCore/QFile>
+
 #if USE(PTHREADS)
 #  include <pthread.h>
 #endif
@@ -355,6 +357,10 @@ ExecutionEngine::ExecutionEngine(QQmlJS::EvalISelFactory *factory)
 
     Scoped<String> name(scope, newString(QStringLiteral("thrower")));
     thrower = newBuiltinFunction(rootContext, name, throwTypeError)->getPointer();
+
+    const QString identifierFile = QString::fromLocal8Bit(qgetenv("QV4_PREINTERN_IDENTIFIERS"));
+    if (!identifierFile.isEmpty() && !preinternIdentifiers(identifierFile))
+        qWarning("QV4_PREINTERN_IDENTIFIERS: cannot read %s", qPrintable(identifierFile));
 }
 
 ExecutionEngine::~ExecutionEngine()
@@ -450,6 +456,33 @@ String *ExecutionEngine::newIdentifier(const QString &text)
     return identifierTable->insertString(text);
 }
 
+// Interns a set of names up front, typically the union of the string tables of all
+// documents an application ships. Linking compilation units then only has to look the
+// names up, and the identifier table is sized once instead of growing repeatedly.
+void ExecutionEngine::preinternIdentifiers(const QStringList &names)
+{
+    identifierTable->reserve(identifierTable->size + names.count());
+    foreach (const QString &name, names)
+        identifierTable->insertString(name);
+}
+
+// Reads the names to intern from a UTF-8 file with one name per line.
+bool ExecutionEngine::preinternIdentifiers(const QString &fileName)
+{
+    QFile f(fileName);
+    if (!f.open(QIODevice::ReadOnly))
+        return false;
+
+    QStringList names;
+    while (!f.atEnd()) {
+        const QString name = QString::fromUtf8(f.readLine()).trimmed();
+        if (!name.isEmpty())
+            names.append(name);
+    }
+    preinternIdentifiers(names);
+    return true;
+}
+
 Returned<Object> *ExecutionEngine::newStringObject(const ValueRef value)
 {
     StringObject *object = new (memoryManager) StringObject(this, value);
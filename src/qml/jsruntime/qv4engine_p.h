@@ -292,6 +292,8 @@ struct Q_QML_EXPORT ExecutionEngine
 
     Returned<String> *newString(const QString &s);
     String *newIdentifier(const QString &text);
+    void preinternIdentifiers(const QStringList &names);
+    bool preinternIdentifiers(const QString &fileName);
 
     Returned<Object> *newStringObject(const ValueRef value);
     Returned<Object> *newNumberObject(const ValueRef value);
@@ -86,26 +86,8 @@ void IdentifierTable::addEntry(String *str)
 
     bool grow = (alloc <= size*2);
 
-    if (grow) {
-        ++numBits;
-        int newAlloc = primeForNumBits(numBits);
-        String **newEntries = (String **)malloc(newAlloc*sizeof(String *));
-        memset(newEntries, 0, newAlloc*sizeof(String *));
-        for (int i = 0; i < alloc; ++i) {
-            String *e = entries[i];
-            if (!e)
-                continue;
-            uint idx = e->stringHash % newAlloc;
-            while (newEntries[idx]) {
-                ++idx;
-                idx %= newAlloc;
-            }
-            newEntries[idx] = e;
-        }
-        free(entries);
-        entries = newEntries;
-        alloc = newAlloc;
-    }
+    if (grow)
+        rehash(numBits + 1);
 
     uint idx = hash % alloc;
     while (entries[idx]) {
@@ -116,24 +98,72 @@ void IdentifierTable::addEntry(String *str)
     ++size;
 }
 
+void IdentifierTable::rehash(int newNumBits)
+{
+    numBits = newNumBits;
+    int newAlloc = primeForNumBits(numBits);
+    String **newEntries = (String **)malloc(newAlloc*sizeof(String *));
+    memset(newEntries, 0, newAlloc*sizeof(String *));
+    for (int i = 0; i < alloc; ++i) {
+        String *e = entries[i];
+        if (!e)
+            continue;
+        uint idx = e->stringHash % newAlloc;
+        while (newEntries[idx]) {
+            ++idx;
+            idx %= newAlloc;
+        }
+        newEntries[idx] = e;
+    }
+    free(entries);
+    entries = newEntries;
+    alloc = newAlloc;
+}
 
+void IdentifierTable::reserve(int count)
+{
+    int bits = numBits;
+    while (primeForNumBits(bits) <= count*2)
+        ++bits;
+    if (bits != numBits)
+        rehash(bits);
+}
 
-String *IdentifierTable::insertString(const QString &s)
+String *IdentifierTable::lookup(const QChar *s, int length, uint hash) const
 {
-    uint hash = String::createHashValue(s.constData(), s.length());
     uint idx = hash % alloc;
     while (String *e = entries[idx]) {
-        if (e->stringHash == hash && e->toQString() == s)
+        // addEntry() flattened the string, so its characters can be compared in place
+        if (e->stringHash == hash && e->_text->size == length
+                && !memcmp(e->_text->data(), s, length * sizeof(QChar)))
             return e;
         ++idx;
         idx %= alloc;
     }
+    return 0;
+}
+
+String *IdentifierTable::insertString(const QString &s)
+{
+    uint hash = String::createHashValue(s.constData(), s.length());
+    if (String *e = lookup(s.constData(), s.length(), hash))
+        return e;
 
     String *str = engine->newString(s)->getPointer();
     addEntry(str);
     return str;
 }
 
+String *IdentifierTable::insertString(const QChar *s, int length, uint hash)
+{
+    if (String *e = lookup(s, length, hash))
+        return e;
+
+    String *str = engine->newString(QString(s, length))->getPointer();
+    addEntry(str);
+    return str;
+}
+
 
 Identifier *IdentifierTable::identifierImpl(const String *str)
 {
@@ -60,6 +60,8 @@ struct IdentifierTable
     String **entries;
 
     void addEntry(String *str);
+    void rehash(int newNumBits);
+    String *lookup(const QChar *s, int length, uint hash) const;
 
 public:
 
@@ -67,6 +69,11 @@ public:
     ~IdentifierTable();
 
     String *insertString(const QString &s);
+    // For strings from compiled units, which carry their hash. Only allocates
+    // a QString if the string is not in the table yet.
+    String *insertString(const QChar *s, int length, uint hash);
+
+    void reserve(int count);
 
     Identifier *identifier(const String *str) {
         if (str->identifier)
@@ -86,8 +86,10 @@ ReturnedValue Lookup::getterGeneric(QV4::Lookup *l, const ValueRef object)
     Object *proto;
     switch (object->type()) {
     case Value::Undefined_Type:
-    case Value::Null_Type:
-        return engine->current->throwTypeError();
+    case Value::Null_Type: {
+        QString message = QStringLiteral("Cannot read property '%1' of %2").arg(l->name->toQString()).arg(object->toQStringNoThrow());
+        return engine->current->throwTypeError(message);
+    }
     case Value::Boolean_Type:
         proto = engine->booleanClass->prototype;
         break;
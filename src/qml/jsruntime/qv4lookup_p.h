@@ -50,6 +50,9 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQmlPropertyCache;
+class QQmlPropertyData;
+
 namespace QV4 {
 
 struct Lookup {
@@ -67,6 +70,10 @@ struct Lookup {
             Object *proto;
             unsigned type;
         };
+        struct {
+            QQmlPropertyCache *propertyCache;
+            QQmlPropertyData *propertyData;
+        };
     };
     int level;
     uint index;
@@ -492,6 +492,14 @@ bool Object::deleteIndexedProperty(Managed *m, uint index)
 ReturnedValue Object::getLookup(Managed *m, Lookup *l)
 {
     Object *o = static_cast<Object *>(m);
+    if (o->vtbl->get != Object::static_vtbl.get) {
+        // The properties of objects with a custom get() do not live in the internal
+        // class, so there is nothing we could cache here.
+        Scope scope(o->engine());
+        ScopedString name(scope, l->name);
+        return o->get(name);
+    }
+
     PropertyAttributes attrs;
     Property *p = l->lookup(o, &attrs);
     if (p) {
@@ -63,6 +63,7 @@
 #include <private/qv4jsonobject_p.h>
 #include <private/qv4regexpobject_p.h>
 #include <private/qv4scopedvalue_p.h>
+#include <private/qv4lookup_p.h>
 
 #include <QtQml/qjsvalue.h>
 #include <QtCore/qjsonarray.h>
@@ -137,6 +138,15 @@ struct ReadAccessor {
         object->qt_metacall(QMetaObject::ReadProperty, property.coreIndex, args);
     }
 
+    static inline void VME(QObject *object, const QQmlPropertyData &property,
+                           void *output, QQmlNotifier **n)
+    {
+        Q_ASSERT(n == 0);
+        Q_UNUSED(n);
+
+        QQmlVMEMetaObject::getForProperty(object, property.coreIndex)->readTypedProperty(property.coreIndex, output);
+    }
+
     static inline void Accessor(QObject *object, const QQmlPropertyData &property,
                                 void *output, QQmlNotifier **n)
     {
@@ -390,6 +400,8 @@ ReturnedValue QObjectWrapper::getProperty(ExecutionContext *ctx, QQmlPropertyDat
         QQmlVMEMetaObject *vmemo = QQmlVMEMetaObject::get(m_object);
         Q_ASSERT(vmemo);
         return vmemo->vmeProperty(property->coreIndex);
+    } else if (property->isVMEProperty()) {
+        return LoadProperty<ReadAccessor::VME>(ctx->engine->v8Engine, m_object, *property, 0);
     } else if (property->isDirect())  {
         return LoadProperty<ReadAccessor::Direct>(ctx->engine->v8Engine, m_object, *property, 0);
     } else {
@@ -500,7 +512,10 @@ void QObjectWrapper::setProperty(QObject *object, ExecutionContext *ctx, QQmlPro
     int status = -1; \
     int flags = 0; \
     void *argv[] = { &o, 0, &status, &flags }; \
-    QMetaObject::metacall(object, QMetaObject::WriteProperty, property->coreIndex, argv);
+    if (property->isVMEProperty()) \
+        QQmlVMEMetaObject::getForProperty(object, property->coreIndex)->writeTypedProperty(property->coreIndex, argv); \
+    else \
+        QMetaObject::metacall(object, QMetaObject::WriteProperty, property->coreIndex, argv);
 
     if (value->isNull() && property->isQObject()) {
         PROPERTY_STORE(QObject*, 0);
@@ -527,6 +542,8 @@ void QObjectWrapper::setProperty(QObject *object, ExecutionContext *ctx, QQmlPro
         PROPERTY_STORE(int, value->asDouble());
     } else if (property->propType == QMetaType::QReal && value->isNumber()) {
         PROPERTY_STORE(qreal, qreal(value->asDouble()));
+    } else if (property->propType == QMetaType::Bool && value->isBoolean()) {
+        PROPERTY_STORE(bool, value->booleanValue());
     } else if (property->propType == QMetaType::Float && value->isNumber()) {
         PROPERTY_STORE(float, float(value->asDouble()));
     } else if (property->propType == QMetaType::Double && value->isNumber()) {
@@ -690,6 +707,109 @@ void QObjectWrapper::put(Managed *m, const StringRef name, const ValueRef value)
     }
 }
 
+// Resolves the property a lookup refers to, if it is a plain property that can be
+// cached for the object's property cache. Methods, signal handlers and the special
+// destroy()/toString() members always take the generic path.
+static QQmlPropertyData *findCacheableProperty(QObjectWrapper *wrapper, Lookup *l, QQmlPropertyCache **cache)
+{
+    QObject *object = wrapper->object();
+    if (QQmlData::wasDeleted(object))
+        return 0;
+    QQmlData *ddata = QQmlData::get(object, false);
+    if (!ddata || !ddata->propertyCache)
+        return 0;
+
+    // The property resolution only depends on the calling context when the object
+    // has QML declared properties, and then only on which component the calling code
+    // belongs to. As a lookup belongs to exactly one function, keying the cache on the
+    // property cache is sufficient.
+    QQmlContextData *qmlContext = QmlContextWrapper::callingContext(wrapper->engine());
+    QQmlPropertyData *property = ddata->propertyCache->property(l->name, object, qmlContext);
+    if (!property || property->isFunction())
+        return 0;
+
+    *cache = ddata->propertyCache;
+    return property;
+}
+
+ReturnedValue QObjectWrapper::getLookup(Managed *m, Lookup *l)
+{
+    QObjectWrapper *that = static_cast<QObjectWrapper*>(m);
+    Scope scope(that->engine());
+    ScopedString name(scope, l->name);
+
+    QQmlPropertyCache *cache = 0;
+    if (QQmlPropertyData *property = findCacheableProperty(that, l, &cache)) {
+        cache->addref();
+        l->propertyCache = cache;
+        l->propertyData = property;
+        l->getter = lookupGetter;
+    }
+    return get(m, name, 0);
+}
+
+void QObjectWrapper::setLookup(Managed *m, Lookup *l, const ValueRef value)
+{
+    QObjectWrapper *that = static_cast<QObjectWrapper*>(m);
+    Scope scope(that->engine());
+    ScopedString name(scope, l->name);
+
+    QQmlPropertyCache *cache = 0;
+    if (QQmlPropertyData *property = findCacheableProperty(that, l, &cache)) {
+        cache->addref();
+        l->propertyCache = cache;
+        l->propertyData = property;
+        l->setter = lookupSetter;
+    }
+    put(m, name, value);
+}
+
+ReturnedValue QObjectWrapper::lookupGetter(Lookup *l, const ValueRef object)
+{
+    QObjectWrapper *that = object->as<QObjectWrapper>();
+    if (that && !QQmlData::wasDeleted(that->m_object)) {
+        QQmlData *ddata = QQmlData::get(that->m_object, false);
+        if (ddata && ddata->propertyCache == l->propertyCache) {
+            QQmlPropertyData *property = l->propertyData;
+            QQmlData::flushPendingBinding(that->m_object, property->coreIndex);
+            return that->getProperty(that->engine()->current, property);
+        }
+    }
+
+    releaseLookup(l);
+    l->getter = Lookup::getterGeneric;
+    return Lookup::getterGeneric(l, object);
+}
+
+void QObjectWrapper::lookupSetter(Lookup *l, const ValueRef object, const ValueRef value)
+{
+    QObjectWrapper *that = object->as<QObjectWrapper>();
+    if (that && !QQmlData::wasDeleted(that->m_object)) {
+        ExecutionEngine *v4 = that->engine();
+        if (v4->hasException)
+            return;
+        QQmlData *ddata = QQmlData::get(that->m_object, false);
+        if (ddata && ddata->propertyCache == l->propertyCache) {
+            setProperty(that->m_object, v4->current, l->propertyData, value);
+            return;
+        }
+    }
+
+    releaseLookup(l);
+    l->setter = Lookup::setterGeneric;
+    Lookup::setterGeneric(l, object, value);
+}
+
+void QObjectWrapper::releaseLookup(Lookup *l)
+{
+    if (l->getter != lookupGetter && l->setter != lookupSetter)
+        return;
+    if (l->propertyCache)
+        l->propertyCache->release();
+    l->propertyCache = 0;
+    l->propertyData = 0;
+}
+
 PropertyAttributes QObjectWrapper::query(const Managed *m, StringRef name)
 {
     const QObjectWrapper *that = static_cast<const QObjectWrapper*>(m);
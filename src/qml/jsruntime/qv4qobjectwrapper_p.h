@@ -97,6 +97,12 @@ struct Q_QML_EXPORT QObjectWrapper : public QV4::Object
     ReturnedValue getProperty(ExecutionContext *ctx, int propertyIndex, bool captureRequired);
     void setProperty(ExecutionContext *ctx, int propertyIndex, const ValueRef value);
 
+    using Object::getLookup;
+    using Object::setLookup;
+    static ReturnedValue lookupGetter(Lookup *l, const ValueRef object);
+    static void lookupSetter(Lookup *l, const ValueRef object, const ValueRef value);
+    static void releaseLookup(Lookup *l);
+
 protected:
     static bool isEqualTo(Managed *that, Managed *o);
 
@@ -115,6 +121,8 @@ private:
 
     static ReturnedValue get(Managed *m, const StringRef name, bool *hasProperty);
     static void put(Managed *m, const StringRef name, const ValueRef value);
+    static ReturnedValue getLookup(Managed *m, Lookup *l);
+    static void setLookup(Managed *m, Lookup *l, const ValueRef value);
     static PropertyAttributes query(const Managed *, StringRef name);
     static Property *advanceIterator(Managed *m, ObjectIterator *it, StringRef name, uint *index, PropertyAttributes *attributes);
     static void markObjects(Managed *that, QV4::ExecutionEngine *e);
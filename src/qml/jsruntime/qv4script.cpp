@@ -303,7 +303,7 @@ Function *Script::function()
     return vmFunction;
 }
 
-CompiledData::CompilationUnit *Script::precompile(ExecutionEngine *engine, const QUrl &url, const QString &source, QList<QQmlError> *reportedErrors)
+CompiledData::CompilationUnit *Script::precompile(ExecutionEngine *engine, const QUrl &url, const QString &source, QList<QQmlError> *reportedErrors, int line)
 {
     using namespace QQmlJS;
     using namespace QQmlJS::AST;
@@ -312,7 +312,7 @@ CompiledData::CompilationUnit *Script::precompile(ExecutionEngine *engine, const
 
     QQmlJS::Engine ee;
     QQmlJS::Lexer lexer(&ee);
-    lexer.setCode(source, /*line*/1, /*qml mode*/true);
+    lexer.setCode(source, line, /*qml mode*/true);
     QQmlJS::Parser parser(&ee);
 
     parser.parseProgram();
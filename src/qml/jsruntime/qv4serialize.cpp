@@ -68,6 +68,11 @@ using namespace QV4;
 //    + Date
 //    + RegExp
 // <quint8 type><quint24 size><data>
+//
+// Large payloads avoid the per element encoding where possible: arrays that
+// contain only numbers are written as one packed block of doubles, and long
+// strings pass a reference to their implicitly shared (and immutable) QString
+// data instead of copying the characters twice.
 
 enum Type {
     WorkerUndefined,
@@ -84,9 +89,16 @@ enum Type {
     WorkerDate,
     WorkerRegexp,
     WorkerListModel,
-    WorkerSequence
+    WorkerSequence,
+    WorkerNumberArray,
+    WorkerSharedString
 };
 
+// Arrays shorter than this are not worth scanning for a packed encoding
+static const quint32 PackedArrayThreshold = 16;
+// Strings at least this long are shared rather than copied
+static const int SharedStringThreshold = 1024;
+
 static inline quint32 valueheader(Type type, quint32 size = 0)
 {
     return quint8(type) << 24 | (size & 0xFFFFFF);
@@ -167,6 +179,15 @@ void Serialize::serialize(QByteArray &data, const QV4::ValueRef v, QV8Engine *en
             push(data, valueheader(WorkerUndefined));
             return;
         }
+        if (length >= SharedStringThreshold) {
+            // The string data is immutable and atomically reference counted, so
+            // the receiving engine can adopt it as is. Released in deserialize(), or
+            // in release() if the data is dropped.
+            reserve(data, sizeof(quint32) + sizeof(void *));
+            push(data, valueheader(WorkerSharedString));
+            push(data, (void *)new QString(qstr));
+            return;
+        }
         int utf16size = ALIGN(length * sizeof(uint16_t));
 
         reserve(data, utf16size + sizeof(quint32));
@@ -188,10 +209,40 @@ void Serialize::serialize(QByteArray &data, const QV4::ValueRef v, QV8Engine *en
             push(data, valueheader(WorkerUndefined));
             return;
         }
-        reserve(data, sizeof(quint32) + length * sizeof(quint32));
-        push(data, valueheader(WorkerArray, length));
         ScopedValue val(scope);
-        for (uint32_t ii = 0; ii < length; ++ii)
+        uint32_t ii = 0;
+        if (length >= PackedArrayThreshold) {
+            // Try to write the array as a block of doubles. Every element is
+            // read exactly once, so the first element that is not a number ends
+            // the attempt and the ones read so far are re-encoded one by one.
+            int offset = data.size();
+            push(data, valueheader(WorkerNumberArray, length));
+            data.resize(offset + sizeof(quint32) + length * sizeof(double));
+            char *buffer = data.data() + offset + sizeof(quint32);
+            for (; ii < length; ++ii) {
+                val = array->getIndexed(ii);
+                if (!val->isNumber())
+                    break;
+                double d = val->asDouble();
+                memcpy(buffer + ii * sizeof(double), &d, sizeof(double));
+            }
+            if (ii == length)
+                return;
+
+            QByteArray numbers(buffer, ii * sizeof(double));
+            data.resize(offset);
+            reserve(data, sizeof(quint32) + length * sizeof(quint32));
+            push(data, valueheader(WorkerArray, length));
+            const double *read = (const double *)numbers.constData();
+            for (uint32_t jj = 0; jj < ii; ++jj)
+                serialize(data, QV4::Primitive::fromDouble(read[jj]), engine);
+            serialize(data, val, engine);
+            ++ii;
+        } else {
+            reserve(data, sizeof(quint32) + length * sizeof(quint32));
+            push(data, valueheader(WorkerArray, length));
+        }
+        for (; ii < length; ++ii)
             serialize(data, (val = array->getIndexed(ii)), engine);
     } else if (v->isInteger()) {
         reserve(data, 2 * sizeof(quint32));
@@ -397,6 +448,25 @@ ReturnedValue Serialize::deserialize(const char *&data, QV8Engine *engine)
         QVariant seqVariant = QV4::SequencePrototype::toVariant(array, sequenceType, &succeeded);
         return QV4::SequencePrototype::fromVariant(v4, seqVariant, &succeeded);
     }
+    case WorkerNumberArray:
+    {
+        quint32 size = headersize(header);
+        Scoped<ArrayObject> array(scope, v4->newArrayObject());
+        array->arrayReserve(size);
+        for (quint32 ii = 0; ii < size; ++ii) {
+            array->arrayData[ii].value = QV4::Primitive::fromDouble(popDouble(data));
+            array->arrayDataLen = ii + 1;
+        }
+        array->setArrayLengthUnchecked(size);
+        return array.asReturnedValue();
+    }
+    case WorkerSharedString:
+    {
+        QString *qstr = (QString *)popPtr(data);
+        QV4::ScopedValue rv(scope, QV4::Encode(v4->newString(*qstr)));
+        delete qstr;
+        return rv.asReturnedValue();
+    }
     }
     Q_ASSERT(!"Unreachable");
     return QV4::Encode::undefined();
@@ -415,5 +485,104 @@ ReturnedValue Serialize::deserialize(const QByteArray &data, QV8Engine *engine)
     return deserialize(stream, engine);
 }
 
+// Walks over serialized data, passing the references that serialize() took to the visitor
+template <typename Visitor>
+static void visitReferences(const char *&data, Visitor &visitor)
+{
+    quint32 header = popUint32(data);
+    Type type = headertype(header);
+
+    switch (type) {
+    case WorkerUndefined:
+    case WorkerNull:
+    case WorkerTrue:
+    case WorkerFalse:
+    case WorkerFunction:
+        break;
+    case WorkerString:
+        data += ALIGN(headersize(header) * sizeof(uint16_t));
+        break;
+    case WorkerArray:
+        for (quint32 ii = 0; ii < headersize(header); ++ii)
+            visitReferences(data, visitor);
+        break;
+    case WorkerObject:
+        for (quint32 ii = 0; ii < headersize(header); ++ii) {
+            visitReferences(data, visitor); // name
+            visitReferences(data, visitor); // value
+        }
+        break;
+    case WorkerInt32:
+    case WorkerUint32:
+        popUint32(data);
+        break;
+    case WorkerNumber:
+    case WorkerDate:
+        popDouble(data);
+        break;
+    case WorkerRegexp:
+    {
+        quint32 length = popUint32(data);
+        data += ALIGN(length * sizeof(uint16_t));
+        break;
+    }
+    case WorkerListModel:
+        visitor.listModel((QQmlListModelWorkerAgent *)popPtr(data));
+        break;
+    case WorkerSequence:
+        // the sequence type followed by the elements
+        for (quint32 ii = 0; ii < headersize(header); ++ii)
+            visitReferences(data, visitor);
+        break;
+    case WorkerNumberArray:
+        data += headersize(header) * sizeof(double);
+        break;
+    case WorkerSharedString:
+        visitor.sharedString((QString *)popPtr(data));
+        break;
+    }
+}
+
+namespace {
+struct ReleaseReferences
+{
+    void listModel(QQmlListModelWorkerAgent *agent) { agent->release(); }
+    void sharedString(QString *string) { delete string; }
+};
+
+struct CollectListModelAgents
+{
+    QList<QQmlListModelWorkerAgent *> agents;
+
+    void listModel(QQmlListModelWorkerAgent *agent)
+    {
+        if (!agents.contains(agent))
+            agents.append(agent);
+    }
+    void sharedString(QString *) {}
+};
+}
+
+// Drops the references that serialize() took for data that will not be deserialized
+void Serialize::release(const QByteArray &data)
+{
+    if (data.isEmpty())
+        return;
+    const char *stream = data.constData();
+    ReleaseReferences visitor;
+    visitReferences(stream, visitor);
+}
+
+// Returns the worker agents of the ListModels passed in data
+QList<QQmlListModelWorkerAgent *> Serialize::listModelAgents(const QByteArray &data)
+{
+    CollectListModelAgents visitor;
+    if (!data.isEmpty()) {
+        const char *stream = data.constData();
+        visitReferences(stream, visitor);
+    }
+    return visitor.agents;
+}
+
 QT_END_NAMESPACE
 
@@ -54,11 +54,13 @@
 //
 
 #include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
 #include <private/qv4value_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QV8Engine;
+class QQmlListModelWorkerAgent;
 
 namespace QV4 {
 
@@ -67,6 +69,8 @@ public:
 
     static QByteArray serialize(const ValueRef, QV8Engine *);
     static ReturnedValue deserialize(const QByteArray &, QV8Engine *);
+    static void release(const QByteArray &);
+    static QList<QQmlListModelWorkerAgent *> listModelAgents(const QByteArray &);
 
 private:
     static void serialize(QByteArray &, const ValueRef, QV8Engine *);
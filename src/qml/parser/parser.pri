@@ -16,6 +16,7 @@ SOURCES += \
     $$PWD/qqmljsengine_p.cpp \
     $$PWD/qqmljsgrammar.cpp \
     $$PWD/qqmljslexer.cpp \
+    $$PWD/qqmljsmemorypool.cpp \
     $$PWD/qqmljsparser.cpp \
 
 OTHER_FILES += \
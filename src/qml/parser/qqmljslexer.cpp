@@ -48,6 +48,14 @@
 #include <QtCore/qvarlengtharray.h>
 #include <QtCore/qdebug.h>
 
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#  define QQMLJS_LEXER_SSE2
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#  include <arm_neon.h>
+#  define QQMLJS_LEXER_NEON
+#endif
+
 QT_BEGIN_NAMESPACE
 Q_CORE_EXPORT double qstrtod(const char *s00, char const **se, bool *ok);
 QT_END_NAMESPACE
@@ -166,6 +174,181 @@ void Lexer::setCode(const QString &code, int lineno, bool qmlMode)
     _delimited = true;
 }
 
+// The functions below implement the fast paths of the inner scanning loops. Each of them
+// returns the first character in [p, end) that the corresponding scalar loop has to look at;
+// the characters before it are known not to be line terminators and can be skipped in bulk.
+// The vector loops only have to be conservative: a block containing a candidate stop
+// character is re-examined with the exact scalar predicate.
+
+static inline bool isPlainTextChar(ushort c, ushort stop1, ushort stop2)
+{
+    return c != '\n' && c != '\r' && c != 0x2028 && c != 0x2029 && c != stop1 && c != stop2;
+}
+
+static inline bool isAsciiIdentifierChar(ushort c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+            || c == '_' || c == '$';
+}
+
+static inline bool isBlankChar(ushort c)
+{
+    return c == ' ' || c == '\t';
+}
+
+#if defined(QQMLJS_LEXER_NEON)
+static inline bool anyLaneSet(uint16x8_t v)
+{
+    const uint64x2_t v64 = vreinterpretq_u64_u16(v);
+    return (vgetq_lane_u64(v64, 0) | vgetq_lane_u64(v64, 1)) != 0;
+}
+#endif
+
+// Finds the next line terminator, \a stop1 or \a stop2. Used for comments and string bodies.
+static const QChar *findLineTerminatorOr(const QChar *p, const QChar *end, ushort stop1, ushort stop2)
+{
+    const ushort *s = reinterpret_cast<const ushort *>(p);
+    const ushort *e = reinterpret_cast<const ushort *>(end);
+
+#if defined(QQMLJS_LEXER_SSE2)
+    const __m128i lf = _mm_set1_epi16('\n');
+    const __m128i cr = _mm_set1_epi16('\r');
+    const __m128i m1 = _mm_set1_epi16(stop1);
+    const __m128i m2 = _mm_set1_epi16(stop2);
+    const __m128i lineSeparator = _mm_set1_epi16(0x2027);
+    const __m128i zero = _mm_setzero_si128();
+    for (; e - s >= 8; s += 8) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        __m128i hit = _mm_or_si128(_mm_cmpeq_epi16(chars, lf), _mm_cmpeq_epi16(chars, cr));
+        hit = _mm_or_si128(hit, _mm_or_si128(_mm_cmpeq_epi16(chars, m1), _mm_cmpeq_epi16(chars, m2)));
+        // lanes <= 0x2027 saturate to zero, everything above is a candidate for U+2028/U+2029
+        const __m128i low = _mm_cmpeq_epi16(_mm_subs_epu16(chars, lineSeparator), zero);
+        if (_mm_movemask_epi8(hit) != 0 || _mm_movemask_epi8(low) != 0xffff) {
+            for (int i = 0; i < 8; ++i) {
+                if (!isPlainTextChar(s[i], stop1, stop2))
+                    return reinterpret_cast<const QChar *>(s + i);
+            }
+        }
+    }
+#elif defined(QQMLJS_LEXER_NEON)
+    const uint16x8_t lf = vdupq_n_u16('\n');
+    const uint16x8_t cr = vdupq_n_u16('\r');
+    const uint16x8_t m1 = vdupq_n_u16(stop1);
+    const uint16x8_t m2 = vdupq_n_u16(stop2);
+    const uint16x8_t lineSeparator = vdupq_n_u16(0x2027);
+    for (; e - s >= 8; s += 8) {
+        const uint16x8_t chars = vld1q_u16(s);
+        uint16x8_t hit = vorrq_u16(vceqq_u16(chars, lf), vceqq_u16(chars, cr));
+        hit = vorrq_u16(hit, vorrq_u16(vceqq_u16(chars, m1), vceqq_u16(chars, m2)));
+        hit = vorrq_u16(hit, vcgtq_u16(chars, lineSeparator));
+        if (anyLaneSet(hit)) {
+            for (int i = 0; i < 8; ++i) {
+                if (!isPlainTextChar(s[i], stop1, stop2))
+                    return reinterpret_cast<const QChar *>(s + i);
+            }
+        }
+    }
+#endif
+
+    for (; s < e; ++s) {
+        if (!isPlainTextChar(*s, stop1, stop2))
+            break;
+    }
+    return reinterpret_cast<const QChar *>(s);
+}
+
+// Finds the end of a run of ASCII identifier characters. Non-ASCII identifier parts and
+// escape sequences are left to the scalar loop.
+static const QChar *findIdentifierEnd(const QChar *p, const QChar *end)
+{
+    const ushort *s = reinterpret_cast<const ushort *>(p);
+    const ushort *e = reinterpret_cast<const ushort *>(end);
+
+#if defined(QQMLJS_LEXER_SSE2)
+    const __m128i caseBit = _mm_set1_epi16(0x20);
+    const __m128i a = _mm_set1_epi16('a');
+    const __m128i zero = _mm_set1_epi16('0');
+    const __m128i letterRange = _mm_set1_epi16('z' - 'a');
+    const __m128i digitRange = _mm_set1_epi16('9' - '0');
+    const __m128i underscore = _mm_set1_epi16('_');
+    const __m128i dollar = _mm_set1_epi16('$');
+    const __m128i nil = _mm_setzero_si128();
+    for (; e - s >= 8; s += 8) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        // unsigned (x - lo) <= range, expressed as a saturating subtraction
+        const __m128i letter = _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(_mm_or_si128(chars, caseBit), a), letterRange), nil);
+        const __m128i digit = _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(chars, zero), digitRange), nil);
+        __m128i ident = _mm_or_si128(letter, digit);
+        ident = _mm_or_si128(ident, _mm_or_si128(_mm_cmpeq_epi16(chars, underscore), _mm_cmpeq_epi16(chars, dollar)));
+        if (_mm_movemask_epi8(ident) != 0xffff) {
+            for (int i = 0; i < 8; ++i) {
+                if (!isAsciiIdentifierChar(s[i]))
+                    return reinterpret_cast<const QChar *>(s + i);
+            }
+        }
+    }
+#elif defined(QQMLJS_LEXER_NEON)
+    const uint16x8_t caseBit = vdupq_n_u16(0x20);
+    const uint16x8_t a = vdupq_n_u16('a');
+    const uint16x8_t zero = vdupq_n_u16('0');
+    const uint16x8_t letterRange = vdupq_n_u16('z' - 'a');
+    const uint16x8_t digitRange = vdupq_n_u16('9' - '0');
+    const uint16x8_t underscore = vdupq_n_u16('_');
+    const uint16x8_t dollar = vdupq_n_u16('$');
+    for (; e - s >= 8; s += 8) {
+        const uint16x8_t chars = vld1q_u16(s);
+        uint16x8_t ident = vcleq_u16(vsubq_u16(vorrq_u16(chars, caseBit), a), letterRange);
+        ident = vorrq_u16(ident, vcleq_u16(vsubq_u16(chars, zero), digitRange));
+        ident = vorrq_u16(ident, vorrq_u16(vceqq_u16(chars, underscore), vceqq_u16(chars, dollar)));
+        if (anyLaneSet(vmvnq_u16(ident))) {
+            for (int i = 0; i < 8; ++i) {
+                if (!isAsciiIdentifierChar(s[i]))
+                    return reinterpret_cast<const QChar *>(s + i);
+            }
+        }
+    }
+#endif
+
+    for (; s < e; ++s) {
+        if (!isAsciiIdentifierChar(*s))
+            break;
+    }
+    return reinterpret_cast<const QChar *>(s);
+}
+
+// Finds the end of a run of spaces and tabs, typically indentation.
+static const QChar *findBlanksEnd(const QChar *p, const QChar *end)
+{
+    const ushort *s = reinterpret_cast<const ushort *>(p);
+    const ushort *e = reinterpret_cast<const ushort *>(end);
+
+#if defined(QQMLJS_LEXER_SSE2)
+    const __m128i space = _mm_set1_epi16(' ');
+    const __m128i tab = _mm_set1_epi16('\t');
+    for (; e - s >= 8; s += 8) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        const __m128i blank = _mm_or_si128(_mm_cmpeq_epi16(chars, space), _mm_cmpeq_epi16(chars, tab));
+        if (_mm_movemask_epi8(blank) != 0xffff)
+            break;
+    }
+#elif defined(QQMLJS_LEXER_NEON)
+    const uint16x8_t space = vdupq_n_u16(' ');
+    const uint16x8_t tab = vdupq_n_u16('\t');
+    for (; e - s >= 8; s += 8) {
+        const uint16x8_t chars = vld1q_u16(s);
+        const uint16x8_t blank = vorrq_u16(vceqq_u16(chars, space), vceqq_u16(chars, tab));
+        if (anyLaneSet(vmvnq_u16(blank)))
+            break;
+    }
+#endif
+
+    for (; s < e; ++s) {
+        if (!isBlankChar(*s))
+            break;
+    }
+    return reinterpret_cast<const QChar *>(s);
+}
+
 void Lexer::scanChar()
 {
     unsigned sequenceLength = isLineTerminatorSequence();
@@ -179,6 +362,17 @@ void Lexer::scanChar()
     }
 }
 
+// Makes the character before \a end the current one without going through scanChar() for
+// the characters in between. The current character and the skipped ones must not be line
+// terminators, which the find functions above guarantee.
+void Lexer::skipTo(const QChar *end)
+{
+    if (end > _codePtr) {
+        _char = end[-1];
+        _codePtr = end;
+    }
+}
+
 namespace {
 inline bool isBinop(int tok)
 {
@@ -432,6 +626,8 @@ again:
                 _terminator = true;
                 syncProhibitAutomaticSemicolon();
             }
+        } else if (isBlankChar(_char.unicode())) {
+            skipTo(findBlanksEnd(_codePtr, _endPtr));
         }
 
         scanChar();
@@ -539,11 +735,14 @@ again:
                         goto again;
                     }
                 } else {
+                    if (!isLineTerminator())
+                        skipTo(findLineTerminatorOr(_codePtr, _endPtr, '*', '*'));
                     scanChar();
                 }
             }
         } else if (_char == QLatin1Char('/')) {
             while (_codePtr <= _endPtr && !isLineTerminator()) {
+                skipTo(findLineTerminatorOr(_codePtr, _endPtr, '\n', '\n'));
                 scanChar();
             }
             if (_engine) {
@@ -700,6 +899,7 @@ again:
 
                     return T_STRING_LITERAL;
                 }
+                skipTo(findLineTerminatorOr(_codePtr, _endPtr, quote.unicode(), '\\'));
                 scanChar();
             }
         }
@@ -862,6 +1062,8 @@ again:
                 } else if (isIdentifierPart(c)) {
                     if (identifierWithEscapeChars)
                         _tokenText += c;
+                    else
+                        skipTo(findIdentifierEnd(_codePtr, _endPtr));
 
                     scanChar();
                     continue;
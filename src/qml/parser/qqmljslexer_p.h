@@ -191,6 +191,7 @@ protected:
 
 private:
     inline void scanChar();
+    inline void skipTo(const QChar *end);
     int scanToken();
     int scanNumber(QChar ch);
 
@@ -0,0 +1,167 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qqmljsmemorypool_p.h"
+
+#include <QtCore/qatomic.h>
+#ifndef QT_BOOTSTRAPPED
+#include <QtCore/qthreadstorage.h>
+#endif
+#include <QtCore/qvarlengtharray.h>
+
+QT_QML_BEGIN_NAMESPACE
+
+namespace QQmlJS {
+
+// Counted in blocks; all pools use the same block size.
+static QBasicAtomicInt blocksInUse = Q_BASIC_ATOMIC_INITIALIZER(0);
+static QBasicAtomicInt peakBlocksInUse = Q_BASIC_ATOMIC_INITIALIZER(0);
+static QBasicAtomicInt blocksCached = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+namespace {
+
+// The cache only needs to cover the pools of one compilation to be reused by the next,
+// so it is kept small: 256 KB per thread and 1 MB across all threads.
+enum {
+    MaximumCachedBlocks = 32,
+    MaximumCachedBlocksTotal = 128
+};
+
+struct BlockCache
+{
+    ~BlockCache()
+    {
+        for (int i = 0; i < blocks.size(); ++i)
+            free(blocks.at(i));
+        blocksCached.fetchAndAddRelaxed(-blocks.size());
+        if (!qgetenv("QML_MEMORYPOOL_STATISTICS").isEmpty())
+            qDebug("QQmlJS::MemoryPool: peak usage %d KB, %d KB released by exiting thread",
+                   int(MemoryPool::peakBytesInUse() / 1024), int(blocks.size() * blockSize / 1024));
+    }
+
+    QVarLengthArray<char *, MaximumCachedBlocks> blocks;
+    static const size_t blockSize = 8 * 1024;
+};
+
+}
+
+#ifndef QT_BOOTSTRAPPED
+static QThreadStorage<BlockCache *> blockCaches;
+#endif
+
+// Returns the calling thread's cache, or 0 if it has none and \a create is false.
+static BlockCache *localBlockCache(bool create)
+{
+#ifdef QT_BOOTSTRAPPED
+    // The bootstrapped tools are single threaded and have no QThreadStorage.  The
+    // cache lives until the process exits.
+    static BlockCache *cache = 0;
+    if (!cache && create)
+        cache = new BlockCache;
+    return cache;
+#else
+    if (blockCaches.hasLocalData())
+        return blockCaches.localData();
+    if (!create)
+        return 0;
+    BlockCache *cache = new BlockCache;
+    blockCaches.setLocalData(cache);
+    return cache;
+#endif
+}
+
+char *MemoryPool::acquireBlock()
+{
+    Q_STATIC_ASSERT(int(BlockCache::blockSize) == int(BLOCK_SIZE));
+
+    int inUse = blocksInUse.fetchAndAddRelaxed(1) + 1;
+    int peak = peakBlocksInUse.load();
+    while (inUse > peak && !peakBlocksInUse.testAndSetRelaxed(peak, inUse))
+        peak = peakBlocksInUse.load();
+
+    BlockCache *cache = localBlockCache(/*create*/ true);
+    if (!cache->blocks.isEmpty()) {
+        char *block = cache->blocks.last();
+        cache->blocks.removeLast();
+        blocksCached.fetchAndAddRelaxed(-1);
+        return block;
+    }
+
+    return (char *) malloc(BLOCK_SIZE);
+}
+
+void MemoryPool::releaseBlock(char *block)
+{
+    blocksInUse.fetchAndAddRelaxed(-1);
+
+    // Pools destroyed while the thread's cache is already gone, or on a thread
+    // that never allocated, free their blocks right away.
+    if (BlockCache *cache = localBlockCache(/*create*/ false)) {
+        if (cache->blocks.size() < MaximumCachedBlocks) {
+            if (blocksCached.fetchAndAddRelaxed(1) < MaximumCachedBlocksTotal) {
+                cache->blocks.append(block);
+                return;
+            }
+            blocksCached.fetchAndAddRelaxed(-1);
+        }
+    }
+
+    free(block);
+}
+
+size_t MemoryPool::bytesInUse()
+{
+    return size_t(blocksInUse.load()) * BLOCK_SIZE;
+}
+
+size_t MemoryPool::peakBytesInUse()
+{
+    return size_t(peakBlocksInUse.load()) * BLOCK_SIZE;
+}
+
+size_t MemoryPool::bytesCached()
+{
+    return size_t(blocksCached.load()) * BLOCK_SIZE;
+}
+
+} // namespace QQmlJS
+
+QT_QML_END_NAMESPACE
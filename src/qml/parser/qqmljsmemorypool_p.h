@@ -84,7 +84,7 @@ public:
         if (_blocks) {
             for (int i = 0; i < _allocatedBlocks; ++i) {
                 if (char *b = _blocks[i])
-                    free(b);
+                    releaseBlock(b);
             }
 
             free(_blocks);
@@ -108,7 +108,18 @@ public:
         _ptr = _end = 0;
     }
 
+    // Blocks of destroyed pools are kept in a per-thread cache and handed to
+    // the next pool, so that compiling many files in a row does not go back
+    // to malloc() for every AST and IR. These report the bytes held by live
+    // pools, the highest value that reached, and the bytes currently cached.
+    static size_t bytesInUse();
+    static size_t peakBytesInUse();
+    static size_t bytesCached();
+
 private:
+    static char *acquireBlock();
+    static void releaseBlock(char *block);
+
     void *allocate_helper(size_t size)
     {
         Q_ASSERT(size < BLOCK_SIZE);
@@ -128,7 +139,7 @@ private:
         char *&block = _blocks[_blockCount];
 
         if (! block)
-            block = (char *) malloc(BLOCK_SIZE);
+            block = acquireBlock();
 
         _ptr = block;
         _end = _ptr + BLOCK_SIZE;
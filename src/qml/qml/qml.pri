@@ -56,6 +56,7 @@ SOURCES += \
     $$PWD/qqmlvaluetypewrapper.cpp \
     $$PWD/qqmltypewrapper.cpp \
     $$PWD/qqmlfileselector.cpp \
+    $$PWD/qqmlcomponentcachewatcher.cpp \
     $$PWD/qqmlobjectcreator.cpp
 
 HEADERS += \
@@ -135,6 +136,7 @@ HEADERS += \
     $$PWD/qqmltypewrapper_p.h \
     $$PWD/qqmlfileselector_p.h \
     $$PWD/qqmlfileselector.h \
+    $$PWD/qqmlcomponentcachewatcher_p.h \
     $$PWD/qqmlobjectcreator_p.h
 
 include(ftw/ftw.pri)
@@ -53,6 +53,7 @@
 #include <private/qqmlprofilerservice_p.h>
 #include <private/qv4debugservice_p.h>
 #include "qqmlinfo.h"
+#include "qqmlcompiler_p.h"
 
 #include <private/qv4value_p.h>
 
@@ -70,17 +71,23 @@ QQmlBoundSignalExpression::QQmlBoundSignalExpression(QObject *target, int index,
                                                      QQmlContextData *ctxt, QObject *scope, const QString &expression,
                                                      const QString &fileName, quint16 line, quint16 column,
                                                      const QString &handlerName,
-                                                     const QString &parameterString)
+                                                     const QString &parameterString,
+                                                     QQmlCompiledData *compiledData, int lazyFunctionIndex)
     : QQmlJavaScriptExpression(&QQmlBoundSignalExpression_jsvtable),
       m_fileName(fileName),
       m_line(line),
       m_column(column),
       m_target(target),
       m_index(index),
+      m_compiledData(compiledData),
+      m_lazyFunctionIndex(lazyFunctionIndex),
       m_expressionFunctionValid(false),
-      m_invalidParameterName(false)
+      m_invalidParameterName(false),
+      m_invalidLazyFunction(false)
 {
     init(ctxt, scope);
+    if (m_compiledData)
+        m_compiledData->addref();
     m_handlerName = handlerName;
     m_parameterString = parameterString;
     m_expression = expression;
@@ -93,8 +100,11 @@ QQmlBoundSignalExpression::QQmlBoundSignalExpression(QObject *target, int index,
       m_column(-1),
       m_target(target),
       m_index(index),
+      m_compiledData(0),
+      m_lazyFunctionIndex(-1),
       m_expressionFunctionValid(true),
-      m_invalidParameterName(false)
+      m_invalidParameterName(false),
+      m_invalidLazyFunction(false)
 {
     init(ctxt, scope);
 }
@@ -111,6 +121,8 @@ void QQmlBoundSignalExpression::init(QQmlContextData *ctxt, QObject *scope)
 
 QQmlBoundSignalExpression::~QQmlBoundSignalExpression()
 {
+    if (m_compiledData)
+        m_compiledData->release();
 }
 
 QString QQmlBoundSignalExpression::expressionIdentifier(QQmlJavaScriptExpression *e)
@@ -142,7 +154,7 @@ void QQmlBoundSignalExpression::evaluate(void **a)
 {
     Q_ASSERT (context() && engine());
 
-    if (m_invalidParameterName)
+    if (m_invalidParameterName || m_invalidLazyFunction)
         return;
 
     QQmlEnginePrivate *ep = QQmlEnginePrivate::get(engine());
@@ -181,8 +193,21 @@ void QQmlBoundSignalExpression::evaluate(void **a)
             m_handlerName.clear();
             m_parameterString.clear();
 
-            m_v8function = evalFunction(context(), scopeObject(), expression,
-                                        m_fileName, m_line, &m_v8qmlscope);
+            if (m_compiledData) {
+                QV4::Function *function = m_compiledData->lazyFunction(m_lazyFunctionIndex, expression, m_line);
+                m_compiledData->release();
+                m_compiledData = 0;
+                if (!function) {
+                    m_invalidLazyFunction = true;
+                    ep->dereferenceScarceResources();
+                    return;
+                }
+                m_v8function = evalFunction(context(), scopeObject(), function,
+                                            m_fileName, m_line, &m_v8qmlscope);
+            } else {
+                m_v8function = evalFunction(context(), scopeObject(), expression,
+                                            m_fileName, m_line, &m_v8qmlscope);
+            }
 
             if (m_v8function.isNullOrUndefined()) {
                 ep->dereferenceScarceResources();
@@ -66,6 +66,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQmlCompiledData;
+
 class Q_QML_PRIVATE_EXPORT QQmlBoundSignalExpression : public QQmlAbstractExpression, public QQmlJavaScriptExpression, public QQmlRefCount
 {
 public:
@@ -73,7 +75,8 @@ public:
                               QQmlContextData *ctxt, QObject *scope, const QString &expression,
                               const QString &fileName, quint16 line, quint16 column,
                               const QString &handlerName = QString(),
-                              const QString &parameterString = QString());
+                              const QString &parameterString = QString(),
+                              QQmlCompiledData *compiledData = 0, int lazyFunctionIndex = -1);
 
     QQmlBoundSignalExpression(QObject *target, int index,
                               QQmlContextData *ctxt, QObject *scope, const QV4::ValueRef &function);
@@ -114,8 +117,13 @@ private:
     QObject *m_target;
     int m_index;
 
+    // set when the handler's code is shared through QQmlCompiledData::lazyFunction()
+    QQmlCompiledData *m_compiledData;
+    int m_lazyFunctionIndex;
+
     bool m_expressionFunctionValid:1;
     bool m_invalidParameterName:1;
+    bool m_invalidLazyFunction:1;
 };
 
 class Q_QML_PRIVATE_EXPORT QQmlAbstractBoundSignal
@@ -52,6 +52,7 @@
 #include <QtCore/qdebug.h>
 
 #include <private/qobject_p.h>
+#include <private/qv4script_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -140,12 +141,40 @@ QQmlCompiledData::~QQmlCompiledData()
     if (compilationUnit)
         compilationUnit->deref();
     free(qmlUnit);
+
+    for (int ii = 0; ii < lazyFunctions.count(); ++ii)
+        if (lazyFunctions.at(ii).unit)
+            lazyFunctions.at(ii).unit->deref();
 }
 
 void QQmlCompiledData::clear()
 {
 }
 
+/*!
+Returns the function of the lazily compiled signal handler \a index, compiling \a code and
+linking it to the engine on the first call.  The function is shared by all instances.
+
+Compilation errors are reported as warnings by the first call only, and 0 is returned.
+*/
+QV4::Function *QQmlCompiledData::lazyFunction(int index, const QString &code, quint16 line)
+{
+    LazyFunction &lazy = lazyFunctions[index];
+    if (!lazy.function && !lazy.failed) {
+        QV4::ExecutionEngine *v4 = QV8Engine::getV4(engine);
+        QList<QQmlError> errors;
+        lazy.unit = QV4::Script::precompile(v4, url, code, &errors, line);
+        if (lazy.unit) {
+            lazy.unit->ref();
+            lazy.function = lazy.unit->linkToEngine(v4);
+        } else {
+            lazy.failed = true;
+            QQmlEnginePrivate::warning(engine, errors);
+        }
+    }
+    return lazy.function;
+}
+
 /*!
 Returns the property cache, if one alread exists.  The cache is not referenced.
 */
@@ -99,9 +99,22 @@ static QString qsTrId_string(QLatin1String("qsTrId"));
 /*!
     Instantiate a new QQmlCompiler.
 */
+/*
+Generating the code of signal handlers on their first emission saves compile time, as
+most handlers never run.  Errors that are only found while generating code, like a break
+outside of a loop, are then reported as warnings when the handler first runs instead of
+failing the component, so this is opt-in.  The variable is read for every compile so
+that it can be changed at runtime.
+*/
+static bool qmlLazySignalHandlers()
+{
+    QByteArray v = qgetenv("QML_LAZY_SIGNAL_HANDLERS");
+    return !v.isEmpty() && v != "0" && v != "false";
+}
+
 QQmlCompiler::QQmlCompiler(QQmlPool *pool)
 : compileState(0), pool(pool), output(0), engine(0), enginePrivate(0), unitRoot(0), unit(0), cachedComponentTypeRef(-1),
-  cachedTranslationContextIndex(-1), componentStats(0)
+  cachedTranslationContextIndex(-1), lazySignalHandlers(qmlLazySignalHandlers()), componentStats(0)
 {
     if (compilerStatDump()) 
         componentStats = pool->New<ComponentStats>();
@@ -921,6 +934,7 @@ void QQmlCompiler::compileTree(QQmlScript::Object *tree)
         QV4::Compiler::JSUnitGenerator jsUnitGenerator(jsModule.data());
         QScopedPointer<QQmlJS::EvalInstructionSelection> isel(v4->iselFactory->create(enginePrivate, v4->executableAllocator, jsModule.data(), &jsUnitGenerator));
         isel->setUseFastLookups(false);
+        isel->setUseFastMemberLookups(true);
         QV4::CompiledData::CompilationUnit *jsUnit = isel->compile(/*generated unit data*/true);
         output->compilationUnit = jsUnit;
         output->compilationUnit->ref();
@@ -1334,7 +1348,14 @@ void QQmlCompiler::genObjectBody(QQmlScript::Object *obj)
         } else if (v->type == Value::SignalExpression) {
 
             Instruction::StoreSignal store;
-            store.runtimeFunctionIndex = compileState->jsCompileData[v->signalData.signalScopeObject].runtimeFunctionIndices.at(v->signalData.functionIndex);
+            if (v->signalData.functionIndex == -1) {
+                store.runtimeFunctionIndex = -1;
+                store.lazyFunctionIndex = output->lazyFunctions.count();
+                output->lazyFunctions.append(QQmlCompiledData::LazyFunction());
+            } else {
+                store.runtimeFunctionIndex = compileState->jsCompileData[v->signalData.signalScopeObject].runtimeFunctionIndices.at(v->signalData.functionIndex);
+                store.lazyFunctionIndex = -1;
+            }
             store.handlerName = output->indexForString(prop->name().toString());
             store.parameters = output->indexForString(obj->metatype->signalParameterStringForJS(prop->index));
             store.signalIndex = prop->index;
@@ -1738,13 +1759,19 @@ bool QQmlCompiler::buildSignal(QQmlScript::Property *prop, QQmlScript::Object *o
             prop->values.first()->signalData.signalExpressionContextStack = ctxt.stack;
             prop->values.first()->signalData.signalScopeObject = ctxt.object;
 
-            QList<QByteArray> parameters = obj->metatype->signalParameterNames(prop->index);
+            if (lazySignalHandlers) {
+                // Generate the handler's code on its first emission instead
+                // (see QQmlCompiledData::lazyFunction()).
+                prop->values.first()->signalData.functionIndex = -1;
+            } else {
+                QList<QByteArray> parameters = obj->metatype->signalParameterNames(prop->index);
 
-            AST::FunctionDeclaration *funcDecl = convertSignalHandlerExpressionToFunctionDeclaration(unit->parser().jsEngine(), prop->values.first()->value.asAST(), propName.toString(), parameters);
+                AST::FunctionDeclaration *funcDecl = convertSignalHandlerExpressionToFunctionDeclaration(unit->parser().jsEngine(), prop->values.first()->value.asAST(), propName.toString(), parameters);
 
-            ComponentCompileState::PerObjectCompileData *cd = &compileState->jsCompileData[ctxt.object];
-            cd->functionsToCompile.append(funcDecl);
-            prop->values.first()->signalData.functionIndex = cd->functionsToCompile.count() - 1;
+                ComponentCompileState::PerObjectCompileData *cd = &compileState->jsCompileData[ctxt.object];
+                cd->functionsToCompile.append(funcDecl);
+                prop->values.first()->signalData.functionIndex = cd->functionsToCompile.count() - 1;
+            }
 
             QString errorString;
             obj->metatype->signalParameterStringForJS(prop->index, &errorString);
@@ -3182,6 +3209,9 @@ bool QQmlCompiler::buildDynamicMeta(QQmlScript::Object *obj, DynamicMetaMode mod
                 propertyFlags |= QQmlPropertyData::IsQList;
         }
 
+        if (QQmlVMEMetaObject::hasTypedStorage(vmePropertyType))
+            propertyFlags |= QQmlPropertyData::IsVMEProperty;
+
         if (!p->isReadOnly && p->type != Object::DynamicProperty::CustomList)
             propertyFlags |= QQmlPropertyData::IsWritable;
 
@@ -3239,6 +3269,7 @@ bool QQmlCompiler::buildDynamicMeta(QQmlScript::Object *obj, DynamicMetaMode mod
 
     // Alias property count.  Actual data is setup in buildDynamicMetaAliases
     ((QQmlVMEMetaData *)dynamicData.data())->aliasCount = aliasCount;
+    ((QQmlVMEMetaData *)dynamicData.data())->updateFlags();
 
     // Dynamic slot data - comes after the property data
     for (Object::DynamicSlot *s = obj->dynamicSlots.first(); s; s = obj->dynamicSlots.next(s)) {
@@ -72,9 +72,11 @@
 QT_BEGIN_NAMESPACE
 
 namespace QV4 {
+struct Function;
 namespace CompiledData {
 struct CompilationUnit;
 struct QmlUnit;
+struct Binding;
 }
 }
 
@@ -144,12 +146,28 @@ public:
     QList<QQmlScriptData *> scripts;
     QList<QUrl> urls;
 
+    // Signal handlers that are only compiled when they are first emitted, indexed by
+    // instr_storeSignal::lazyFunctionIndex. Each is compiled and linked once and its
+    // function is shared by all instances.
+    struct LazyFunction {
+        LazyFunction() : unit(0), function(0), failed(false) {}
+        QV4::CompiledData::CompilationUnit *unit;
+        QV4::Function *function;
+        bool failed;
+    };
+    QVector<LazyFunction> lazyFunctions;
+    QV4::Function *lazyFunction(int index, const QString &code, quint16 line);
+
     // --- new compiler
     QV4::CompiledData::CompilationUnit *compilationUnit;
     QV4::CompiledData::QmlUnit *qmlUnit;
     // index in first hash is component index, hash inside maps from object index in that scope to integer id
     QHash<int, QHash<int, int> > objectIndexToIdPerComponent;
     QHash<int, int> objectIndexToIdForRoot;
+    // prepared on the type loader thread, so that object creation only has to assign them
+    QVector<QQmlContextData::ObjectIdMapping> idMappingsForRoot;
+    QHash<int, QVector<QQmlContextData::ObjectIdMapping> > idMappingsPerComponent;
+    QHash<const QV4::CompiledData::Binding *, QVariant> preparedBindingValues;
 
     bool isComponent(int objectIndex) const { return objectIndexToIdPerComponent.contains(objectIndex); }
     bool isCompositeType() const { return !datas.at(qmlUnit->indexOfRootObject).isEmpty(); }
@@ -476,6 +494,8 @@ private:
     QQmlTypeData *unit;
     int cachedComponentTypeRef;
     int cachedTranslationContextIndex;
+    // Only generate code for signal handlers on their first emission. Set QML_LAZY_SIGNAL_HANDLERS=1
+    bool lazySignalHandlers;
 
     QScopedPointer<QQmlJS::V4IR::Module> jsModule;
 
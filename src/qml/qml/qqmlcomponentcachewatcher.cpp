@@ -0,0 +1,131 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qqmlcomponentcachewatcher_p.h"
+
+#ifndef QT_NO_FILESYSTEMWATCHER
+
+#include <private/qqmlengine_p.h>
+#include <private/qqmltypeloader_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+\class QQmlComponentCacheWatcher
+\brief The QQmlComponentCacheWatcher class drops changed documents from an engine's component cache.
+\internal
+
+The watcher observes the files of all documents, scripts and qmldir files the engine has
+loaded.  When some of them change, it waits for delay() milliseconds so that a burst of
+writes is handled once, and then calls QQmlTypeLoader::clearChangedFiles().  Only the
+changed files and the documents depending on them are dropped; everything else stays
+compiled.  componentsInvalidated() is emitted with the dropped URLs, which is the point
+where an application would recreate its root component.
+
+The type loader only hashes the content of loaded files while a watcher exists.  Files
+loaded before the watcher was created are compared against their content at that time.
+*/
+
+QQmlComponentCacheWatcher::QQmlComponentCacheWatcher(QQmlEngine *engine, QObject *parent)
+: QObject(parent), m_engine(engine)
+{
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(100);
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(invalidate()));
+    connect(&m_watcher, SIGNAL(fileChanged(QString)), this, SLOT(fileChanged()));
+    QQmlEnginePrivate::get(m_engine)->typeLoader.enableContentHashing();
+    watchLoadedFiles();
+}
+
+QQmlComponentCacheWatcher::~QQmlComponentCacheWatcher()
+{
+    QQmlEnginePrivate::get(m_engine)->typeLoader.disableContentHashing();
+}
+
+/*!
+Starts watching the files currently in the component cache.  This is done on construction
+and after every invalidation; call it again after loading further documents.
+*/
+void QQmlComponentCacheWatcher::watchLoadedFiles()
+{
+    QStringList files = QQmlEnginePrivate::get(m_engine)->typeLoader.cachedLocalFiles();
+    const QStringList watched = m_watcher.files();
+    for (QStringList::Iterator iter = files.begin(); iter != files.end();) {
+        if (watched.contains(*iter))
+            iter = files.erase(iter);
+        else
+            ++iter;
+    }
+    if (!files.isEmpty())
+        m_watcher.addPaths(files);
+}
+
+int QQmlComponentCacheWatcher::delay() const
+{
+    return m_timer.interval();
+}
+
+void QQmlComponentCacheWatcher::setDelay(int msecs)
+{
+    m_timer.setInterval(msecs);
+}
+
+void QQmlComponentCacheWatcher::fileChanged()
+{
+    m_timer.start();
+}
+
+void QQmlComponentCacheWatcher::invalidate()
+{
+    const QList<QUrl> urls = QQmlEnginePrivate::get(m_engine)->typeLoader.clearChangedFiles();
+
+    // Editors often save by replacing the file, which removes it from the watcher.
+    if (!m_watcher.files().isEmpty())
+        m_watcher.removePaths(m_watcher.files());
+    watchLoadedFiles();
+
+    if (!urls.isEmpty())
+        emit componentsInvalidated(urls);
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_FILESYSTEMWATCHER
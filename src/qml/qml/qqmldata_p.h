@@ -81,9 +81,9 @@ public:
     QQmlData()
         : ownedByQml1(false), ownMemory(true), ownContext(false), indestructible(true), explicitIndestructibleSet(false),
           hasTaintedV8Object(false), isQueuedForDeletion(false), rootObjectInCreation(false),
-          hasVMEMetaObject(false), parentFrozen(false), notifyList(0), context(0), outerContext(0),
-          bindings(0), signalHandlers(0), nextContextObject(0), prevContextObject(0), bindingBitsSize(0), bindingBits(0),
-          lineNumber(0), columnNumber(0), compiledData(0), deferredData(0), jsEngineId(0),
+          hasVMEMetaObject(false), parentFrozen(false), bindingBitsSize(0), notifyList(0), context(0), outerContext(0),
+          bindings(0), signalHandlers(0), nextContextObject(0), prevContextObject(0), bindingBits(0),
+          lineNumber(0), columnNumber(0), jsEngineId(0), compiledData(0),
           propertyCache(0), guards(0), extendedData(0) {
         init();
     }
@@ -129,6 +129,11 @@ public:
     quint32 parentFrozen:1;
     quint32 dummy:22;
 
+    // Members are ordered so that the 32 bit fields pair up and no padding
+    // is needed on 64 bit platforms. Rarely used state lives in the lazily
+    // allocated extended data instead.
+    int bindingBitsSize;
+
     struct NotifyList {
         quint64 connectionMask;
 
@@ -161,7 +166,6 @@ public:
     QQmlData *nextContextObject;
     QQmlData**prevContextObject;
 
-    int bindingBitsSize;
     quint32 *bindingBits; 
 
     inline bool hasBindingBit(int) const;
@@ -175,15 +179,18 @@ public:
     quint16 lineNumber;
     quint16 columnNumber;
 
+    quint32 jsEngineId; // id of the engine that cerated the jsWrapper
+
     struct DeferredData {
         unsigned int deferredIdx;
         QQmlCompiledData *compiledData;//Not always the same as the other compiledData
         QQmlContextData *context;//Could be either context or outerContext
     };
     QQmlCompiledData *compiledData;
-    DeferredData *deferredData;
 
-    quint32 jsEngineId; // id of the engine that cerated the jsWrapper
+    DeferredData *deferredData() const;
+    void setDeferredData(DeferredData *);
+
     QV4::WeakValue jsWrapper;
 
     QQmlPropertyCache *propertyCache;
@@ -198,8 +205,7 @@ public:
         } else if (priv->declarativeData) {
             return static_cast<QQmlData *>(priv->declarativeData);
         } else if (create) {
-            priv->declarativeData = new QQmlData;
-            return static_cast<QQmlData *>(priv->declarativeData);
+            return createQQmlData(priv);
         } else {
             return 0;
         }
@@ -222,7 +228,12 @@ public:
 
     static inline void flushPendingBinding(QObject *, int coreIndex);
 
+    // Records the object for QML_DATA_STATISTICS once its QQmlData is set
+    static void objectCreated(QObject *);
+
 private:
+    static QQmlData *createQQmlData(QObjectPrivate *priv);
+
     // For attachedProperties
     mutable QQmlDataExtended *extendedData;
 
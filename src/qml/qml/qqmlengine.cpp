@@ -553,7 +553,7 @@ QQmlEnginePrivate::QQmlEnginePrivate(QQmlEngine *e)
 : propertyCapture(0), rootContext(0), isDebugging(false),
   outputWarningsToStdErr(true),
   cleanup(0), erroredBindings(0), inProgressCreations(0),
-  workerScriptEngine(0), activeVME(0),
+  activeVME(0),
   activeObjectCreator(0),
   networkAccessManager(0), networkAccessManagerFactory(0), urlInterceptor(0),
   scarceResourcesRefCount(0), importDatabase(e), typeLoader(e), uniqueId(1),
@@ -781,11 +781,20 @@ void QQmlData::flushPendingBindingImpl(int coreIndex)
     }
 }
 
+// Whether QQmlData memory is recorded, see QQmlDataStatistics
+static QBasicAtomicInt qmlDataStatisticsEnabled = Q_BASIC_ATOMIC_INITIALIZER(0);
+static void qmlDataStatisticsReport();
+
 bool QQmlEnginePrivate::baseModulesUninitialized = true;
 void QQmlEnginePrivate::init()
 {
     Q_Q(QQmlEngine);
 
+    // Read for every engine rather than once per process, so that it can be
+    // enabled for a part of an application or test.
+    const QByteArray statistics = qgetenv("QML_DATA_STATISTICS");
+    qmlDataStatisticsEnabled.store(!statistics.isEmpty() && statistics != "0" && statistics != "false");
+
     if (baseModulesUninitialized) {
         qmlRegisterType<QQmlComponent>("QML", 1, 0, "Component"); // required for the Compiler.
         registerBaseTypes("QtQml", 2, 0); // import which provides language building blocks.
@@ -818,12 +827,37 @@ void QQmlEnginePrivate::init()
     }
 }
 
+static int qmlWorkerScriptThreadCount()
+{
+    bool ok = false;
+    int count = qgetenv("QML_WORKERSCRIPT_THREADS").toInt(&ok);
+    return ok ? qMax(1, count) : 1;
+}
+
+/*
+WorkerScripts are distributed over a pool of worker engines, each running in
+its own thread, so that one busy script does not hold up the others.  A script
+keeps the engine it is registered with, since its state lives there.  New
+scripts go to the engine hosting the fewest scripts, and another engine is
+started while all existing ones are in use.  The pool size is set with
+QML_WORKERSCRIPT_THREADS and defaults to a single engine.
+*/
 QQuickWorkerScriptEngine *QQmlEnginePrivate::getWorkerScriptEngine()
 {
     Q_Q(QQmlEngine);
-    if (!workerScriptEngine)
-        workerScriptEngine = new QQuickWorkerScriptEngine(q);
-    return workerScriptEngine;
+    QQuickWorkerScriptEngine *engine = 0;
+    for (int ii = 0; ii < workerScriptEngines.count(); ++ii) {
+        QQuickWorkerScriptEngine *candidate = workerScriptEngines.at(ii);
+        if (!engine || candidate->workerScriptCount() < engine->workerScriptCount())
+            engine = candidate;
+    }
+
+    if (!engine || (engine->workerScriptCount() > 0
+                    && workerScriptEngines.count() < qmlWorkerScriptThreadCount())) {
+        engine = new QQuickWorkerScriptEngine(q);
+        workerScriptEngines.append(engine);
+    }
+    return engine;
 }
 
 /*!
@@ -909,6 +943,9 @@ QQmlEngine::~QQmlEngine()
     QList<QQmlType*> singletonTypes = QQmlMetaType::qmlSingletonTypes();
     foreach (QQmlType *currType, singletonTypes)
         currType->singletonInstanceInfo()->destroy(this);
+
+    if (qmlDataStatisticsEnabled.load())
+        qmlDataStatisticsReport();
 }
 
 /*! \fn void QQmlEngine::quit()
@@ -1338,7 +1375,8 @@ void qmlExecuteDeferred(QObject *object)
 {
     QQmlData *data = QQmlData::get(object);
 
-    if (data && data->deferredData && !data->wasDeleted(object)) {
+    QQmlData::DeferredData *deferred = data ? data->deferredData() : 0;
+    if (deferred && !data->wasDeleted(object)) {
         QQmlObjectCreatingProfiler prof;
         if (prof.enabled) {
             QQmlType *type = QQmlMetaType::qmlType(object->metaObject());
@@ -1353,9 +1391,9 @@ void qmlExecuteDeferred(QObject *object)
         QQmlComponentPrivate::beginDeferred(ep, object, &state);
 
         // Release the reference for the deferral action (we still have one from construction)
-        data->deferredData->compiledData->release();
-        delete data->deferredData;
-        data->deferredData = 0;
+        deferred->compiledData->release();
+        delete deferred;
+        data->setDeferredData(0);
 
         QQmlComponentPrivate::complete(ep, &state);
     }
@@ -1461,9 +1499,11 @@ public:
     ~QQmlDataExtended();
 
     QHash<int, QObject *> attachedProperties;
+    QQmlData::DeferredData *deferredData;
 };
 
 QQmlDataExtended::QQmlDataExtended()
+    : deferredData(0)
 {
 }
 
@@ -1471,6 +1511,105 @@ QQmlDataExtended::~QQmlDataExtended()
 {
 }
 
+namespace {
+
+/*
+    Collects the memory QQmlData uses when QML_DATA_STATISTICS is set at the
+    time an engine is created.  Objects are counted per type when their QQmlData
+    is created, and the lazily allocated notifier lists, binding bits and
+    extended data when they are allocated or grown, so objects that are still
+    alive are included.  The totals since the previous report are printed when
+    an engine is destroyed.
+*/
+struct QQmlDataStatistics
+{
+    struct Entry {
+        Entry() : count(0), bytes(0) {}
+        int count;
+        qint64 bytes;
+    };
+
+    void recordObject(const char *type);
+    void recordAllocation(Entry QQmlDataStatistics::*part, bool created, size_t bytes);
+    void report();
+
+    QMutex mutex;
+    QHash<QByteArray, Entry> objects;
+    Entry notifyLists;
+    Entry bindingBits;
+    Entry extendedData;
+};
+
+void QQmlDataStatistics::recordObject(const char *type)
+{
+    QMutexLocker lock(&mutex);
+    Entry &e = objects[QByteArray(type)];
+    ++e.count;
+    e.bytes += sizeof(QQmlData);
+}
+
+void QQmlDataStatistics::recordAllocation(Entry QQmlDataStatistics::*part, bool created, size_t bytes)
+{
+    QMutexLocker lock(&mutex);
+    Entry &e = this->*part;
+    if (created)
+        ++e.count;
+    e.bytes += bytes;
+}
+
+void QQmlDataStatistics::report()
+{
+    QMutexLocker lock(&mutex);
+    if (objects.isEmpty())
+        return;
+
+    qDebug("QQmlData statistics (sizeof(QQmlData) = %d):", int(sizeof(QQmlData)));
+    Entry total;
+    for (QHash<QByteArray, Entry>::ConstIterator it = objects.constBegin(); it != objects.constEnd(); ++it) {
+        qDebug("    %s: objects=%d bytes=%lld", it.key().constData(), it->count, it->bytes);
+        total.count += it->count;
+        total.bytes += it->bytes;
+    }
+    qDebug("    notifyLists=%d bytes=%lld", notifyLists.count, notifyLists.bytes);
+    qDebug("    bindingBits=%d bytes=%lld", bindingBits.count, bindingBits.bytes);
+    qDebug("    extended=%d bytes=%lld", extendedData.count, extendedData.bytes);
+    total.bytes += notifyLists.bytes + bindingBits.bytes + extendedData.bytes;
+    qDebug("    total: objects=%d bytes=%lld", total.count, total.bytes);
+
+    objects.clear();
+    notifyLists = bindingBits = extendedData = Entry();
+}
+
+}
+
+Q_GLOBAL_STATIC(QQmlDataStatistics, qmlDataStatisticsInstance)
+
+static void qmlDataStatisticsAllocation(QQmlDataStatistics::Entry QQmlDataStatistics::*part,
+                                        bool created, size_t bytes)
+{
+    if (Q_UNLIKELY(qmlDataStatisticsEnabled.load()))
+        qmlDataStatisticsInstance()->recordAllocation(part, created, bytes);
+}
+
+static void qmlDataStatisticsReport()
+{
+    qmlDataStatisticsInstance()->report();
+}
+
+void QQmlData::objectCreated(QObject *object)
+{
+    if (Q_UNLIKELY(qmlDataStatisticsEnabled.load()))
+        qmlDataStatisticsInstance()->recordObject(object->metaObject()->className());
+}
+
+QQmlData *QQmlData::createQQmlData(QObjectPrivate *priv)
+{
+    QQmlData *data = new QQmlData;
+    priv->declarativeData = data;
+    objectCreated(priv->q_ptr);
+    return data;
+}
+
 void QQmlData::NotifyList::layout(QQmlNotifierEndpoint *endpoint)
 {
     if (endpoint->next)
@@ -1496,6 +1635,7 @@ void QQmlData::NotifyList::layout()
         const int memsetSize = (maximumTodoIndex - notifiesSize + 1) *
                                sizeof(QQmlNotifierEndpoint*);
         memset(notifies + notifiesSize, 0, memsetSize);
+        qmlDataStatisticsAllocation(&QQmlDataStatistics::notifyLists, false, memsetSize);
 
         if (notifies != old) {
             for (int ii = 0; ii < notifiesSize; ++ii)
@@ -1521,6 +1661,7 @@ void QQmlData::addNotify(int index, QQmlNotifierEndpoint *endpoint)
         notifyList->notifiesSize = 0;
         notifyList->todo = 0;
         notifyList->notifies = 0;
+        qmlDataStatisticsAllocation(&QQmlDataStatistics::notifyLists, true, sizeof(NotifyList));
     }
 
     Q_ASSERT(!endpoint->isConnected());
@@ -1571,10 +1712,29 @@ void QQmlData::disconnectNotifiers()
 
 QHash<int, QObject *> *QQmlData::attachedProperties() const
 {
-    if (!extendedData) extendedData = new QQmlDataExtended;
+    if (!extendedData) {
+        extendedData = new QQmlDataExtended;
+        qmlDataStatisticsAllocation(&QQmlDataStatistics::extendedData, true, sizeof(QQmlDataExtended));
+    }
     return &extendedData->attachedProperties;
 }
 
+QQmlData::DeferredData *QQmlData::deferredData() const
+{
+    return extendedData ? extendedData->deferredData : 0;
+}
+
+void QQmlData::setDeferredData(DeferredData *data)
+{
+    if (!extendedData) {
+        if (!data)
+            return;
+        extendedData = new QQmlDataExtended;
+        qmlDataStatisticsAllocation(&QQmlDataStatistics::extendedData, true, sizeof(QQmlDataExtended));
+    }
+    extendedData->deferredData = data;
+}
+
 void QQmlData::destroyed(QObject *object)
 {
     if (nextContextObject)
@@ -1596,10 +1756,10 @@ void QQmlData::destroyed(QObject *object)
         compiledData = 0;
     }
 
-    if (deferredData) {
-        deferredData->compiledData->release();
-        delete deferredData;
-        deferredData = 0;
+    if (DeferredData *deferred = deferredData()) {
+        deferred->compiledData->release();
+        delete deferred;
+        extendedData->deferredData = 0;
     }
 
     QQmlAbstractBoundSignal *signalHandler = signalHandlers;
@@ -1701,6 +1861,8 @@ static void QQmlData_setBit(QQmlData *data, QObject *obj, int bit)
         memset(data->bindingBits + oldArraySize,
                0x00,
                sizeof(quint32) * (arraySize - oldArraySize));
+        qmlDataStatisticsAllocation(&QQmlDataStatistics::bindingBits, oldArraySize == 0,
+                                    sizeof(quint32) * (arraySize - oldArraySize));
 
         data->bindingBitsSize = arraySize * 32;
     }
@@ -57,6 +57,17 @@
 #include <private/qfieldlist_p.h>
 #include <QtCore/qjsonobject.h>
 #include <QtCore/qjsonarray.h>
+#include <QtCore/qdatastream.h>
+#include <QtCore/qsavefile.h>
+#include <QtCore/qset.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qthreadpool.h>
+#include <private/qqmlprofilerservice_p.h>
 
 #include <algorithm>
 
@@ -73,6 +84,279 @@ static const QLatin1String Slash_qmldir("/qmldir");
 static const QLatin1String String_qmldir("qmldir");
 static const QString dotqml_string(QLatin1String(".qml"));
 
+/*
+    Keeps the results of qmldir location and plugin resolution across application
+    runs, so that a warm start does not probe every import path again.  It is
+    enabled by setting QML_IMPORT_CACHE to the file the cache is stored in.
+
+    The cache as a whole is only trusted while the import and plugin paths are the
+    same and none of their directories has been modified since it was written.
+    Each entry also records the modification time of the file that was found, if
+    any, and of the nearest existing directory of every location probed before it.
+    Adding or removing a file or directory modifies its parent directory, so an
+    entry is dropped when its result could have changed anywhere below the search
+    paths.  These are checked when an entry is first used.
+*/
+class QQmlImportDiskCache
+{
+public:
+    QQmlImportDiskCache(QQmlImportDatabase *database, const QString &fileName);
+
+    bool findQmldir(const QString &uri, int vmaj, int vmin, QString *filePath, QString *url);
+    void insertQmldir(const QString &uri, int vmaj, int vmin, const QString &filePath, const QString &url,
+                      const QStringList &probedPaths);
+
+    bool findPlugin(const QString &key, QString *filePath);
+    void insertPlugin(const QString &key, const QString &filePath, const QStringList &probedPaths);
+
+    void invalidate();
+    void save();
+
+private:
+    struct Entry {
+        Entry() : modified(-1), validated(false) {}
+        QString filePath;
+        QString url;
+        qint64 modified;
+        QStringList directories;
+        QList<qint64> directoryTimes;
+        bool validated;
+    };
+    typedef QHash<QString, Entry> Entries;
+
+    void load();
+    bool validate(Entries &entries, Entries::Iterator it);
+    static void stampDirectories(Entry *entry, const QStringList &probedPaths);
+    static QString qmldirKey(const QString &uri, int vmaj, int vmin);
+    static qint64 modificationTime(const QString &path);
+
+    QQmlImportDatabase *m_database;
+    QString m_fileName;
+    QStringList m_paths;
+    QList<qint64> m_pathTimes;
+    Entries m_qmldirs;
+    Entries m_plugins;
+    bool m_loaded;
+    bool m_dirty;
+};
+
+static const quint32 importDiskCacheMagic = 0x514d4943; // "QMIC"
+static const quint32 importDiskCacheVersion = 2;
+
+QQmlImportDiskCache::QQmlImportDiskCache(QQmlImportDatabase *database, const QString &fileName)
+: m_database(database), m_fileName(fileName), m_loaded(false), m_dirty(false)
+{
+}
+
+QString QQmlImportDiskCache::qmldirKey(const QString &uri, int vmaj, int vmin)
+{
+    return uri + Slash + QString::number(vmaj) + Dot + QString::number(vmin);
+}
+
+qint64 QQmlImportDiskCache::modificationTime(const QString &path)
+{
+    QFileInfo info(path);
+    if (!info.exists())
+        return -1;
+    return info.lastModified().toMSecsSinceEpoch();
+}
+
+void QQmlImportDiskCache::load()
+{
+    m_loaded = true;
+    m_qmldirs.clear();
+    m_plugins.clear();
+
+    m_paths = m_database->importPathList(QQmlImportDatabase::Local) + m_database->filePluginPath;
+    m_pathTimes.clear();
+    foreach (const QString &path, m_paths)
+        m_pathTimes.append(modificationTime(path));
+
+    QFile file(m_fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_2);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QStringList paths;
+    QList<qint64> pathTimes;
+    stream >> magic >> version;
+    if (magic != importDiskCacheMagic || version != importDiskCacheVersion)
+        return;
+    stream >> paths >> pathTimes;
+    if (paths != m_paths || pathTimes != m_pathTimes) {
+        if (qmlImportTrace())
+            qDebug() << "QQmlImportDiskCache: discarding out of date cache" << m_fileName;
+        m_dirty = true;
+        return;
+    }
+
+    Entries *tables[] = { &m_qmldirs, &m_plugins };
+    for (int ii = 0; ii < 2; ++ii) {
+        quint32 count = 0;
+        stream >> count;
+        for (quint32 jj = 0; jj < count && stream.status() == QDataStream::Ok; ++jj) {
+            QString key;
+            Entry entry;
+            stream >> key >> entry.filePath >> entry.url >> entry.modified
+                   >> entry.directories >> entry.directoryTimes;
+            tables[ii]->insert(key, entry);
+        }
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        m_qmldirs.clear();
+        m_plugins.clear();
+        m_dirty = true;
+    }
+}
+
+bool QQmlImportDiskCache::validate(Entries &entries, Entries::Iterator it)
+{
+    if (it->validated)
+        return true;
+
+    bool valid = it->filePath.isEmpty() || modificationTime(it->filePath) == it->modified;
+    for (int ii = 0; valid && ii < it->directories.count(); ++ii)
+        valid = modificationTime(it->directories.at(ii)) == it->directoryTimes.at(ii);
+
+    if (!valid) {
+        if (qmlImportTrace())
+            qDebug() << "QQmlImportDiskCache: discarding out of date entry" << it.key();
+        entries.erase(it);
+        m_dirty = true;
+        return false;
+    }
+
+    it->validated = true;
+    return true;
+}
+
+/*
+    Records the modification time of the nearest existing directory of each of
+    \a probedPaths.  A file or directory appearing at any of those paths modifies
+    one of these directories.
+*/
+void QQmlImportDiskCache::stampDirectories(Entry *entry, const QStringList &probedPaths)
+{
+    QSet<QString> stamped;
+    foreach (const QString &path, probedPaths) {
+        QString directory = path;
+        qint64 modified = -1;
+        while (modified == -1) {
+            const int slash = directory.lastIndexOf(Slash);
+            if (slash <= 0)
+                break;
+            directory.truncate(slash);
+            if (stamped.contains(directory))
+                break;
+            modified = modificationTime(directory);
+        }
+        if (modified != -1) {
+            stamped.insert(directory);
+            entry->directories.append(directory);
+            entry->directoryTimes.append(modified);
+        }
+    }
+}
+
+bool QQmlImportDiskCache::findQmldir(const QString &uri, int vmaj, int vmin, QString *filePath, QString *url)
+{
+    if (!m_loaded)
+        load();
+
+    Entries::Iterator it = m_qmldirs.find(qmldirKey(uri, vmaj, vmin));
+    if (it == m_qmldirs.end() || !validate(m_qmldirs, it))
+        return false;
+
+    *filePath = it->filePath;
+    *url = it->url;
+    return true;
+}
+
+void QQmlImportDiskCache::insertQmldir(const QString &uri, int vmaj, int vmin, const QString &filePath, const QString &url,
+                                       const QStringList &probedPaths)
+{
+    if (!m_loaded)
+        load();
+
+    Entry entry;
+    entry.filePath = filePath;
+    entry.url = url;
+    if (!filePath.isEmpty())
+        entry.modified = modificationTime(filePath);
+    stampDirectories(&entry, probedPaths);
+    entry.validated = true;
+    m_qmldirs.insert(qmldirKey(uri, vmaj, vmin), entry);
+    m_dirty = true;
+}
+
+bool QQmlImportDiskCache::findPlugin(const QString &key, QString *filePath)
+{
+    if (!m_loaded)
+        load();
+
+    Entries::Iterator it = m_plugins.find(key);
+    if (it == m_plugins.end() || !validate(m_plugins, it))
+        return false;
+
+    *filePath = it->filePath;
+    return true;
+}
+
+void QQmlImportDiskCache::insertPlugin(const QString &key, const QString &filePath, const QStringList &probedPaths)
+{
+    if (!m_loaded)
+        load();
+
+    Entry entry;
+    entry.filePath = filePath;
+    entry.modified = modificationTime(filePath);
+    stampDirectories(&entry, probedPaths);
+    entry.validated = true;
+    m_plugins.insert(key, entry);
+    m_dirty = true;
+}
+
+// Called when the search paths change.  The entries are reloaded, and checked
+// against the new paths, on the next lookup.
+void QQmlImportDiskCache::invalidate()
+{
+    if (m_dirty)
+        save();
+    m_loaded = false;
+    m_qmldirs.clear();
+    m_plugins.clear();
+}
+
+void QQmlImportDiskCache::save()
+{
+    if (!m_loaded || !m_dirty)
+        return;
+    m_dirty = false;
+
+    QSaveFile file(m_fileName);
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_2);
+    stream << importDiskCacheMagic << importDiskCacheVersion << m_paths << m_pathTimes;
+
+    const Entries *tables[] = { &m_qmldirs, &m_plugins };
+    for (int ii = 0; ii < 2; ++ii) {
+        stream << quint32(tables[ii]->count());
+        for (Entries::ConstIterator it = tables[ii]->constBegin(); it != tables[ii]->constEnd(); ++it)
+            stream << it.key() << it->filePath << it->url << it->modified
+                   << it->directories << it->directoryTimes;
+    }
+
+    file.commit();
+}
+
 namespace {
 
 QString resolveLocalUrl(const QString &url, const QString &relative)
@@ -182,6 +466,12 @@ struct RegisteredPlugin {
 
 typedef QMap<QString, RegisteredPlugin> StringRegisteredPluginMap;
 Q_GLOBAL_STATIC(StringRegisteredPluginMap, qmlEnginePluginsWithRegisteredTypes); // stores the uri and the PluginLoaders
+
+// Plugins loaded ahead of their import by preloadPlugins(), keyed by absolute file path
+typedef QHash<QString, QPluginLoader *> StringPluginLoaderHash;
+Q_GLOBAL_STATIC(StringPluginLoaderHash, qmlPreloadedPlugins);
+Q_GLOBAL_STATIC(QMutex, qmlPreloadedPluginsMutex);
+
 void qmlClearEnginePlugins()
 {
     foreach (RegisteredPlugin plugin, qmlEnginePluginsWithRegisteredTypes()->values()) {
@@ -191,8 +481,64 @@ void qmlClearEnginePlugins()
         delete loader;
     }
     qmlEnginePluginsWithRegisteredTypes()->clear();
+
+    QMutexLocker locker(qmlPreloadedPluginsMutex());
+    foreach (QPluginLoader *loader, qmlPreloadedPlugins()->values()) {
+        loader->unload();
+        delete loader;
+    }
+    qmlPreloadedPlugins()->clear();
 }
 
+#ifndef QT_NO_LIBRARY
+/*
+Loads and instantiates a single plugin on a loader worker.  Type registration and
+engine initialization are left to importPlugin(), which picks up the loader from
+qmlPreloadedPlugins().
+*/
+class QQmlPluginPreloadJob : public QRunnable
+{
+public:
+    QQmlPluginPreloadJob(const QString &filePath, QThread *thread, QSemaphore *done)
+        : m_filePath(filePath), m_thread(thread), m_done(done) {}
+
+    virtual void run()
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        QPluginLoader *loader = new QPluginLoader(m_filePath);
+        if (loader->load() && loader->instance()) {
+            // Give the instance the affinity it would have had if it was loaded on import
+            loader->instance()->moveToThread(m_thread);
+
+            QMutexLocker locker(qmlPreloadedPluginsMutex());
+            if (!qmlPreloadedPlugins()->contains(m_filePath)) {
+                qmlPreloadedPlugins()->insert(m_filePath, loader);
+                loader = 0;
+            }
+        }
+        // Failures are reported again, with context, when the import is processed.
+        if (loader) {
+            if (loader->isLoaded())
+                loader->unload();
+            delete loader;
+        }
+
+        if (qmlImportTrace())
+            qDebug().nospace() << "QQmlImportDatabase::preloadPlugins: loaded " << m_filePath
+                               << " in " << timer.elapsed() << "ms";
+
+        m_done->release();
+    }
+
+private:
+    QString m_filePath;
+    QThread *m_thread;
+    QSemaphore *m_done;
+};
+#endif
+
 typedef QPair<QStaticPlugin, QJsonArray> StaticPluginPair;
 
 class QQmlImportNamespace
@@ -1078,14 +1424,35 @@ bool QQmlImportsPrivate::locateQmldir(const QString &uri, int vmaj, int vmin, QQ
     }
     }
 
+    if (database->diskCache) {
+        QString filePath;
+        QString url;
+        if (database->diskCache->findQmldir(uri, vmaj, vmin, &filePath, &url)) {
+            QQmlImportDatabase::QmldirCache *cache = new QQmlImportDatabase::QmldirCache;
+            cache->versionMajor = vmaj;
+            cache->versionMinor = vmin;
+            cache->qmldirFilePath = filePath;
+            cache->qmldirPathUrl = url;
+            cache->next = cacheHead;
+            database->qmldirCache.insert(uri, cache);
+
+            *outQmldirFilePath = filePath;
+            *outQmldirPathUrl = url;
+            return !filePath.isEmpty();
+        }
+    }
+
     QQmlTypeLoader &typeLoader = QQmlEnginePrivate::get(database->engine)->typeLoader;
 
     QStringList localImportPaths = database->importPathList(QQmlImportDatabase::Local);
+    QStringList probedPaths;
 
     // Search local import paths for a matching version
     for (int version = QQmlImports::FullyVersioned; version <= QQmlImports::Unversioned; ++version) {
         foreach (const QString &path, localImportPaths) {
             QString qmldirPath = QQmlImports::completeQmldirPath(uri, path, vmaj, vmin, static_cast<QQmlImports::ImportVersion>(version));
+            if (database->diskCache)
+                probedPaths.append(qmldirPath);
 
             QString absoluteFilePath = typeLoader.absoluteFilePath(qmldirPath);
             if (!absoluteFilePath.isEmpty()) {
@@ -1104,6 +1471,9 @@ bool QQmlImportsPrivate::locateQmldir(const QString &uri, int vmaj, int vmin, QQ
                 cache->next = cacheHead;
                 database->qmldirCache.insert(uri, cache);
 
+                if (database->diskCache)
+                    database->diskCache->insertQmldir(uri, vmaj, vmin, absoluteFilePath, url, probedPaths);
+
                 *outQmldirFilePath = absoluteFilePath;
                 *outQmldirPathUrl = url;
 
@@ -1118,6 +1488,9 @@ bool QQmlImportsPrivate::locateQmldir(const QString &uri, int vmaj, int vmin, QQ
     cache->next = cacheHead;
     database->qmldirCache.insert(uri, cache);
 
+    if (database->diskCache)
+        database->diskCache->insertQmldir(uri, vmaj, vmin, QString(), QString(), probedPaths);
+
     return false;
 }
 
@@ -1546,7 +1919,7 @@ bool QQmlImports::isLocal(const QUrl &url)
 \internal
 */
 QQmlImportDatabase::QQmlImportDatabase(QQmlEngine *e)
-: engine(e)
+: diskCache(0), engine(e)
 {
     filePluginPath << QLatin1String(".");
 
@@ -1569,12 +1942,21 @@ QQmlImportDatabase::QQmlImportDatabase(QQmlEngine *e)
     }
 
     addImportPath(QCoreApplication::applicationDirPath());
+
+    QString diskCacheFile = QString::fromLocal8Bit(qgetenv("QML_IMPORT_CACHE"));
+    if (!diskCacheFile.isEmpty())
+        diskCache = new QQmlImportDiskCache(this, diskCacheFile);
 }
 
 QQmlImportDatabase::~QQmlImportDatabase()
 {
     qDeleteAll(qmldirCache);
     qmldirCache.clear();
+
+    if (diskCache) {
+        diskCache->save();
+        delete diskCache;
+    }
 }
 
 /*!
@@ -1591,7 +1973,16 @@ QString QQmlImportDatabase::resolvePlugin(QQmlTypeLoader *typeLoader,
                                           const QString &baseName, const QStringList &suffixes,
                                           const QString &prefix)
 {
+    QString diskCacheKey;
+    if (diskCache) {
+        diskCacheKey = qmldirPath + Slash + qmldirPluginPath + Slash + prefix + baseName;
+        QString cachedPath;
+        if (diskCache->findPlugin(diskCacheKey, &cachedPath))
+            return cachedPath;
+    }
+
     QStringList searchPaths = filePluginPath;
+    QStringList probedPaths;
     bool qmldirPluginPathIsRelative = QDir::isRelativePath(qmldirPluginPath);
     if (!qmldirPluginPathIsRelative)
         searchPaths.prepend(qmldirPluginPath);
@@ -1625,8 +2016,13 @@ QString QQmlImportDatabase::resolvePlugin(QQmlTypeLoader *typeLoader,
             pluginFileName += suffix;
 
             QString absolutePath = typeLoader->absoluteFilePath(resolvedPath + pluginFileName);
-            if (!absolutePath.isEmpty())
+            if (diskCache)
+                probedPaths.append(resolvedPath + pluginFileName);
+            if (!absolutePath.isEmpty()) {
+                if (diskCache)
+                    diskCache->insertPlugin(diskCacheKey, absolutePath, probedPaths);
                 return absolutePath;
+            }
         }
     }
 
@@ -1725,6 +2121,9 @@ void QQmlImportDatabase::setPluginPathList(const QStringList &paths)
         qDebug().nospace() << "QQmlImportDatabase::setPluginPathList: " << paths;
 
     filePluginPath = paths;
+
+    if (diskCache)
+        diskCache->invalidate();
 }
 
 /*!
@@ -1743,6 +2142,9 @@ void QQmlImportDatabase::addPluginPath(const QString& path)
     } else {
         filePluginPath.prepend(path);
     }
+
+    if (diskCache)
+        diskCache->invalidate();
 }
 
 /*!
@@ -1776,8 +2178,12 @@ void QQmlImportDatabase::addImportPath(const QString& path)
     }
 
     if (!cPath.isEmpty()
-        && !fileImportPath.contains(cPath))
+        && !fileImportPath.contains(cPath)) {
         fileImportPath.prepend(cPath);
+
+        if (diskCache)
+            diskCache->invalidate();
+    }
 }
 
 /*!
@@ -1810,6 +2216,91 @@ void QQmlImportDatabase::setImportPathList(const QStringList &paths)
 
     // Our existing cached paths may have been invalidated
     qmldirCache.clear();
+
+    if (diskCache)
+        diskCache->invalidate();
+}
+
+/*!
+    \internal
+
+    Returns the resolved paths of the dynamic \a plugins, listed in the qmldir file at
+    \a qmldirFilePath, that have not been loaded yet.
+*/
+QStringList QQmlImportDatabase::pluginsToPreload(QQmlTypeLoader *typeLoader, const QString &qmldirFilePath,
+                                                 const QList<QQmlDirParser::Plugin> &plugins)
+{
+    QStringList paths;
+#if !defined(QT_NO_LIBRARY) && defined(QT_SHARED)
+    if (plugins.isEmpty() || qmlDirFilesForWhichPluginsHaveBeenLoaded.contains(qmldirFilePath))
+        return paths;
+
+    QString qmldirPath = qmldirFilePath;
+    int slash = qmldirPath.lastIndexOf(Slash);
+    if (slash > 0)
+        qmldirPath.truncate(slash);
+
+    foreach (const QQmlDirParser::Plugin &plugin, plugins) {
+        QString resolvedFilePath = resolvePlugin(typeLoader, qmldirPath, plugin.path, plugin.name);
+        if (resolvedFilePath.isEmpty())
+            continue;
+        const QString absoluteFilePath = QFileInfo(resolvedFilePath).absoluteFilePath();
+        if (!qmlEnginePluginsWithRegisteredTypes()->contains(absoluteFilePath))
+            paths.append(absoluteFilePath);
+    }
+#else
+    Q_UNUSED(typeLoader);
+    Q_UNUSED(qmldirFilePath);
+    Q_UNUSED(plugins);
+#endif
+    return paths;
+}
+
+/*!
+    \internal
+
+    Loads the plugin libraries at \a filePaths and creates their root instances on
+    \a pool, returning once all of them are done.  Registering their types and
+    initializing the engine still happens in importPlugin(), in import order, so this
+    only moves the file system and dynamic linker work off the critical path.
+*/
+void QQmlImportDatabase::preloadPlugins(const QStringList &filePaths, QThreadPool *pool)
+{
+#ifndef QT_NO_LIBRARY
+    if (!pool || filePaths.count() < 2)
+        return;
+
+    QQmlCompilingProfiler prof(QLatin1String("plugins: ") + filePaths.join(QLatin1String(", ")));
+
+    QSemaphore done;
+    foreach (const QString &filePath, filePaths)
+        pool->start(new QQmlPluginPreloadJob(filePath, QThread::currentThread(), &done));
+    done.acquire(filePaths.count());
+#else
+    Q_UNUSED(filePaths);
+    Q_UNUSED(pool);
+#endif
+}
+
+/*!
+    \internal
+
+    Unloads the plugins at \a filePaths that were preloaded but not picked up by
+    importPlugin(), for instance because an earlier import of the same document failed.
+*/
+void QQmlImportDatabase::releasePreloadedPlugins(const QStringList &filePaths)
+{
+#ifndef QT_NO_LIBRARY
+    QMutexLocker locker(qmlPreloadedPluginsMutex());
+    foreach (const QString &filePath, filePaths) {
+        if (QPluginLoader *loader = qmlPreloadedPlugins()->take(filePath)) {
+            loader->unload();
+            delete loader;
+        }
+    }
+#else
+    Q_UNUSED(filePaths);
+#endif
 }
 
 /*!
@@ -1837,6 +2328,8 @@ bool QQmlImportDatabase::importPlugin(QObject *instance, const QString &basePath
 
     QStringList registrationFailures;
     {
+        QQmlCompilingProfiler prof(QLatin1String("registerTypes: ") + uri);
+
         // Create a scope for QWriteLocker to keep it as narrow as possible, and
         // to ensure that we release it before the call to initalizeEngine below
         QWriteLocker lock(QQmlMetaType::typeRegistrationLock());
@@ -1891,6 +2384,7 @@ bool QQmlImportDatabase::importPlugin(QObject *instance, const QString &basePath
 
     if (initEngine) {
         if (QQmlExtensionInterface *eiface = qobject_cast<QQmlExtensionInterface *>(instance)) {
+            QQmlCompilingProfiler prof(QLatin1String("initializeEngine: ") + uri);
             QQmlEnginePrivate *ep = QQmlEnginePrivate::get(engine);
             ep->typeLoader.initializeEngine(eiface, moduleId);
         }
@@ -1929,16 +2423,20 @@ bool QQmlImportDatabase::importPlugin(const QString &filePath, const QString &ur
 
         QPluginLoader* loader = 0;
         if (!typesRegistered) {
-            loader = new QPluginLoader(absoluteFilePath);
+            {
+                QMutexLocker locker(qmlPreloadedPluginsMutex());
+                loader = qmlPreloadedPlugins()->take(absoluteFilePath);
+            }
+            if (!loader)
+                loader = new QPluginLoader(absoluteFilePath);
 
-            if (!loader->load()) {
+            if (!loader->isLoaded() && !loader->load()) {
                 if (errors) {
                     QQmlError error;
                     error.setDescription(loader->errorString());
                     errors->prepend(error);
-
-                    delete loader;
                 }
+                delete loader;
                 return false;
             }
         } else {
@@ -1965,9 +2463,10 @@ bool QQmlImportDatabase::importPlugin(const QString &filePath, const QString &ur
              initializedPlugins.insert(absoluteFilePath);
 
              if (QQmlExtensionInterface *eiface = qobject_cast<QQmlExtensionInterface *>(instance)) {
+                 QQmlCompilingProfiler prof(QLatin1String("initializeEngine: ") + uri);
                  QQmlEnginePrivate *ep = QQmlEnginePrivate::get(engine);
-                 const char *moduleId = uri.toUtf8().constData();
-                 ep->typeLoader.initializeEngine(eiface, moduleId);
+                 const QByteArray moduleId = uri.toUtf8();
+                 ep->typeLoader.initializeEngine(eiface, moduleId.constData());
              }
          }
     }
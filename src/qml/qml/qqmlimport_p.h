@@ -70,6 +70,7 @@ class QQmlImportNamespace;
 class QQmlImportsPrivate;
 class QQmlImportDatabase;
 class QQmlTypeLoader;
+class QThreadPool;
 
 class Q_QML_PRIVATE_EXPORT QQmlImports
 {
@@ -142,6 +143,7 @@ private:
     QQmlImportsPrivate *d;
 };
 
+class QQmlImportDiskCache;
 class QQmlImportDatabase
 {
     Q_DECLARE_TR_FUNCTIONS(QQmlImportDatabase)
@@ -153,6 +155,11 @@ public:
 
     bool importPlugin(const QString &filePath, const QString &uri, const QString &importNamespace, QList<QQmlError> *errors);
 
+    QStringList pluginsToPreload(QQmlTypeLoader *typeLoader, const QString &qmldirFilePath,
+                                 const QList<QQmlDirParser::Plugin> &plugins);
+    void preloadPlugins(const QStringList &filePaths, QThreadPool *pool);
+    void releasePreloadedPlugins(const QStringList &filePaths);
+
     QStringList importPathList(PathType type = LocalOrRemote) const;
     void setImportPathList(const QStringList &paths);
     void addImportPath(const QString& dir);
@@ -163,6 +170,7 @@ public:
 
 private:
     friend class QQmlImportsPrivate;
+    friend class QQmlImportDiskCache;
     QString resolvePlugin(QQmlTypeLoader *typeLoader,
                           const QString &qmldirPath, const QString &qmldirPluginPath,
                           const QString &baseName, const QStringList &suffixes,
@@ -184,6 +192,9 @@ private:
     // Used in QQmlImportsPrivate::locateQmldir()
     QStringHash<QmldirCache *> qmldirCache;
 
+    // Persists qmldir and plugin lookups across runs, if enabled
+    QQmlImportDiskCache *diskCache;
+
     // XXX thread
     QStringList filePluginPath;
     QStringList fileImportPath;
@@ -388,6 +388,7 @@ union QQmlInstruction
     struct instr_storeSignal {
         QML_INSTR_HEADER
         int runtimeFunctionIndex;
+        int lazyFunctionIndex;
         int handlerName;
         int parameters;
         int signalIndex;
@@ -285,6 +285,31 @@ QQmlDelayedError *QQmlJavaScriptExpression::delayedError()
     return &m_vtable.value();
 }
 
+// Reports an exception thrown while evaluating a function expression, which \a ctx was
+// current for, or returns the \a result.
+static QV4::ReturnedValue evalFunctionResult(QQmlEnginePrivate *ep, QV4::ExecutionContext *ctx,
+                                             const QV4::ValueRef result, QV4::ObjectRef qmlScopeObject,
+                                             QObject *scopeObject, const QString &filename, quint16 line,
+                                             QV4::PersistentValue *qmlscope)
+{
+    QV4::ExecutionEngine *v4 = QV8Engine::getV4(ep->v8engine());
+    if (v4->hasException) {
+        QQmlError error = QV4::ExecutionEngine::catchExceptionAsQmlError(ctx);
+        if (error.description().isEmpty())
+            error.setDescription(QLatin1String("Exception occurred during function evaluation"));
+        if (error.line() == -1)
+            error.setLine(line);
+        if (error.url().isEmpty())
+            error.setUrl(QUrl::fromLocalFile(filename));
+        error.setObject(scopeObject);
+        ep->warning(error);
+        return QV4::Encode::undefined();
+    }
+    if (qmlscope)
+        *qmlscope = qmlScopeObject;
+    return result.asReturnedValue();
+}
+
 QV4::ReturnedValue
 QQmlJavaScriptExpression::evalFunction(QQmlContextData *ctxt, QObject *scopeObject,
                                        const QString &code, const QString &filename, quint16 line,
@@ -303,21 +328,29 @@ QQmlJavaScriptExpression::evalFunction(QQmlContextData *ctxt, QObject *scopeObje
     script.parse();
     if (!v4->hasException)
         result = script.run();
-    if (v4->hasException) {
-        QQmlError error = QV4::ExecutionEngine::catchExceptionAsQmlError(ctx);
-        if (error.description().isEmpty())
-            error.setDescription(QLatin1String("Exception occurred during function evaluation"));
-        if (error.line() == -1)
-            error.setLine(line);
-        if (error.url().isEmpty())
-            error.setUrl(QUrl::fromLocalFile(filename));
-        error.setObject(scopeObject);
-        ep->warning(error);
-        return QV4::Encode::undefined();
-    }
-    if (qmlscope)
-        *qmlscope = qmlScopeObject;
-    return result.asReturnedValue();
+    return evalFunctionResult(ep, ctx, result, qmlScopeObject, scopeObject, filename, line, qmlscope);
+}
+
+QV4::ReturnedValue
+QQmlJavaScriptExpression::evalFunction(QQmlContextData *ctxt, QObject *scopeObject,
+                                       QV4::Function *function,
+                                       const QString &filename, quint16 line,
+                                       QV4::PersistentValue *qmlscope)
+{
+    QQmlEngine *engine = ctxt->engine;
+    QQmlEnginePrivate *ep = QQmlEnginePrivate::get(engine);
+
+    QV4::ExecutionEngine *v4 = QV8Engine::getV4(ep->v8engine());
+    QV4::ExecutionContext *ctx = v4->current;
+    QV4::Scope scope(v4);
+
+    // The function's unit is linked once and shared, only the QML scope is per instance.
+    QV4::ScopedObject qmlScopeObject(scope, QV4::QmlContextWrapper::qmlScope(ep->v8engine(), ctxt, scopeObject));
+    QV4::Scoped<QV4::FunctionObject> wrapper(scope, new (v4->memoryManager) QV4::QmlBindingWrapper(v4->rootContext, function, qmlScopeObject));
+    QV4::ScopedCallData callData(scope, 0);
+    callData->thisObject = QV4::Primitive::undefinedValue();
+    QV4::ScopedValue result(scope, wrapper->call(callData));
+    return evalFunctionResult(ep, ctx, result, qmlScopeObject, scopeObject, filename, line, qmlscope);
 }
 
 QV4::ReturnedValue QQmlJavaScriptExpression::qmlBinding(QQmlContextData *ctxt, QObject *qmlScope,
@@ -62,6 +62,7 @@ QT_BEGIN_NAMESPACE
 
 namespace QV4 {
 struct ExecutionContext;
+struct Function;
 }
 
 class QQmlDelayedError
@@ -148,6 +149,11 @@ public:
                                                      const QString &code, const QString &filename,
                                                      quint16 line,
                                                      QV4::PersistentValue *qmlscope = 0);
+    // as above, but runs code that has already been compiled and linked
+    static QV4::ReturnedValue evalFunction(QQmlContextData *ctxt, QObject *scope,
+                                           QV4::Function *function,
+                                           const QString &filename, quint16 line,
+                                           QV4::PersistentValue *qmlscope = 0);
     // doesn't require rewriting the expression
     static QV4::ReturnedValue qmlBinding(QQmlContextData *ctxt, QObject *scope,
                                         const QString &code,
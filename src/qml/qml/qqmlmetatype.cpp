@@ -67,10 +67,12 @@
 
 QT_BEGIN_NAMESPACE
 
-struct QQmlMetaTypeData
+/*
+    The tables answering type queries.  They are shared by QQmlMetaTypeData and
+    its read-only copies, see QQmlMetaTypeSnapshot.
+*/
+struct QQmlMetaTypeLookupTables
 {
-    QQmlMetaTypeData();
-    ~QQmlMetaTypeData();
     QList<QQmlType *> types;
     typedef QHash<int, QQmlType *> Ids;
     Ids idToType;
@@ -84,6 +86,18 @@ struct QQmlMetaTypeData
                                   // a module via qmlRegisterCompositeType.
     typedef QHash<const QMetaObject *, QQmlType *> MetaObjects;
     MetaObjects metaObjectToType;
+
+    QBitArray objects;
+    QBitArray interfaces;
+    QBitArray lists;
+};
+
+struct QQmlMetaTypeSnapshot;
+
+struct QQmlMetaTypeData : public QQmlMetaTypeLookupTables
+{
+    QQmlMetaTypeData();
+    ~QQmlMetaTypeData();
     typedef QHash<int, QQmlMetaType::StringConverter> StringConverters;
     StringConverters stringConverters;
 
@@ -101,16 +115,48 @@ struct QQmlMetaTypeData
     typedef QHash<VersionedUri, QQmlTypeModule *> TypeModules;
     TypeModules uriToModule;
 
-    QBitArray objects;
-    QBitArray interfaces;
-    QBitArray lists;
-
     QList<QQmlPrivate::AutoParentFunction> parentFunctions;
 
     QSet<QString> protectedNamespaces;
 
     QString typeRegistrationNamespace;
     QStringList typeRegistrationFailures;
+
+    // Read-only copy of the lookup tables, see QQmlMetaTypeSnapshot
+    QAtomicPointer<const QQmlMetaTypeSnapshot> snapshot;
+    QAtomicInt snapshotEpoch;
+    QAtomicInt snapshotReaders[2];
+    QAtomicInt unsnapshottedReads;
+    QList<const QQmlMetaTypeSnapshot *> retiredSnapshots;
+    QList<const QQmlMetaTypeSnapshot *> expiredSnapshots;
+    void invalidateSnapshot();
+};
+
+/*
+    An immutable copy of the lookup tables of QQmlMetaTypeData that is published
+    through an atomic pointer, so that the frequent type queries can be answered
+    without taking metaTypeDataLock.
+
+    Registrations, which hold the write lock, unpublish the current snapshot.
+    Until a new one is published readers query QQmlMetaTypeData itself under the
+    read lock.  The copy shares the tables implicitly, so the cost of a snapshot
+    is that the next registration detaches them.  To keep a series of
+    registrations interleaved with queries linear, a new snapshot is only built
+    once there were as many locked queries since the last registration as there
+    are types.
+
+    A snapshot that was unpublished may still be in use by a lock-free reader.
+    Readers therefore access snapshots through QQmlMetaTypeSnapshotReader, which
+    counts them in one of two counters selected by the parity of snapshotEpoch.
+    When a registration finds no readers left in the previous epoch, it deletes the
+    snapshots that were unpublished before that epoch began and starts a new one.
+    As readers only hold a snapshot for the duration of a single query, at most the
+    snapshots unpublished since the previous registration are kept alive.
+*/
+struct QQmlMetaTypeSnapshot : public QQmlMetaTypeLookupTables
+{
+    explicit QQmlMetaTypeSnapshot(const QQmlMetaTypeLookupTables &tables)
+        : QQmlMetaTypeLookupTables(tables) {}
 };
 
 class QQmlTypeModulePrivate
@@ -153,8 +199,96 @@ QQmlMetaTypeData::~QQmlMetaTypeData()
     TypeModules::const_iterator i = uriToModule.constBegin();
     for (; i != uriToModule.constEnd(); ++i)
         delete *i;
+
+    delete snapshot.load();
+    qDeleteAll(retiredSnapshots);
+    qDeleteAll(expiredSnapshots);
 }
 
+// NOTE: caller must hold a QWriteLocker on "data"
+void QQmlMetaTypeData::invalidateSnapshot()
+{
+    unsnapshottedReads.store(0);
+    if (const QQmlMetaTypeSnapshot *current = snapshot.fetchAndStoreOrdered(0))
+        retiredSnapshots.append(current);
+
+    // Only readers that began in the previous epoch can still hold a snapshot that was
+    // unpublished before the current epoch began.  Once they are gone those snapshots
+    // can be deleted, and the ones unpublished since wait for the current readers.
+    const int epoch = snapshotEpoch.loadAcquire();
+    if (snapshotReaders[(epoch + 1) & 1].loadAcquire() == 0
+            && (!expiredSnapshots.isEmpty() || !retiredSnapshots.isEmpty())) {
+        qDeleteAll(expiredSnapshots);
+        expiredSnapshots = retiredSnapshots;
+        retiredSnapshots.clear();
+        snapshotEpoch.fetchAndAddOrdered(1);
+    }
+}
+
+/*
+    Gives access to the lookup tables for the duration of a query.  That is the
+    current snapshot, which is kept alive while the reader exists, or if there is
+    none QQmlMetaTypeData itself, which is kept read locked.  See
+    QQmlMetaTypeSnapshot.
+*/
+class QQmlMetaTypeSnapshotReader
+{
+public:
+    QQmlMetaTypeSnapshotReader()
+        : data(metaTypeData()), lock(0)
+    {
+        forever {
+            epoch = data->snapshotEpoch.loadAcquire();
+            data->snapshotReaders[epoch & 1].ref();
+            if (data->snapshotEpoch.loadAcquire() == epoch)
+                break;
+            data->snapshotReaders[epoch & 1].deref();
+        }
+
+        current = data->snapshot.loadAcquire();
+        if (current)
+            return;
+
+        lock = metaTypeDataLock();
+        lock->lockForRead();
+        current = data->snapshot.loadAcquire();
+        if (!current && data->unsnapshottedReads.fetchAndAddRelaxed(1) >= data->types.count()) {
+            QQmlMetaTypeSnapshot *fresh = new QQmlMetaTypeSnapshot(*data);
+            if (data->snapshot.testAndSetOrdered(0, fresh)) {
+                current = fresh;
+            } else {
+                // Another reader published its copy first
+                delete fresh;
+                current = data->snapshot.loadAcquire();
+            }
+        }
+
+        if (current) {
+            lock->unlock();
+            lock = 0;
+        } else {
+            current = data;
+        }
+    }
+
+    ~QQmlMetaTypeSnapshotReader()
+    {
+        if (lock)
+            lock->unlock();
+        data->snapshotReaders[epoch & 1].deref();
+    }
+
+    const QQmlMetaTypeLookupTables *operator->() const { return current; }
+
+private:
+    Q_DISABLE_COPY(QQmlMetaTypeSnapshotReader)
+
+    QQmlMetaTypeData *data;
+    const QQmlMetaTypeLookupTables *current;
+    QReadWriteLock *lock;
+    int epoch;
+};
+
 class QQmlTypePrivate
 {
 public:
@@ -1097,6 +1231,8 @@ void qmlClearTypeRegistrations() // Declared in qqml.h
     QWriteLocker lock(metaTypeDataLock());
     QQmlMetaTypeData *data = metaTypeData();
 
+    data->invalidateSnapshot();
+
     for (int i = 0; i < data->types.count(); ++i)
         delete data->types.at(i);
 
@@ -1134,6 +1270,8 @@ int registerInterface(const QQmlPrivate::RegisterInterface &interface)
     QWriteLocker lock(metaTypeDataLock());
     QQmlMetaTypeData *data = metaTypeData();
 
+    data->invalidateSnapshot();
+
     int index = data->types.count();
 
     QQmlType *type = new QQmlType(index, interface);
@@ -1223,6 +1361,8 @@ bool checkRegistration(QQmlType::RegistrationType typeType, QQmlMetaTypeData *da
 // NOTE: caller must hold a QWriteLocker on "data"
 void addTypeToData(QQmlType* type, QQmlMetaTypeData *data)
 {
+    data->invalidateSnapshot();
+
     if (!type->elementName().isEmpty())
         data->nameToType.insertMulti(type->elementName(), type);
 
@@ -1511,8 +1651,7 @@ bool QQmlMetaType::isQObject(int userType)
     if (userType == QMetaType::QObjectStar)
         return true;
 
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
     return userType >= 0 && userType < data->objects.size() && data->objects.testBit(userType);
 }
 
@@ -1521,8 +1660,7 @@ bool QQmlMetaType::isQObject(int userType)
  */
 int QQmlMetaType::listType(int id)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
     QQmlType *type = data->idToType.value(id);
     if (type && type->qListTypeId() == id)
         return type->typeId();
@@ -1532,8 +1670,7 @@ int QQmlMetaType::listType(int id)
 
 int QQmlMetaType::attachedPropertiesFuncId(const QMetaObject *mo)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
 
     QQmlType *type = data->metaObjectToType.value(mo);
     if (type && type->attachedPropertiesFunction())
@@ -1546,8 +1683,7 @@ QQmlAttachedPropertiesFunc QQmlMetaType::attachedPropertiesFuncById(int id)
 {
     if (id < 0)
         return 0;
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
     return data->types.at(id)->attachedPropertiesFunction();
 }
 
@@ -1610,8 +1746,7 @@ QQmlMetaType::TypeCategory QQmlMetaType::typeCategory(int userType)
     if (userType == QMetaType::QObjectStar)
         return Object;
 
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
     if (userType < data->objects.size() && data->objects.testBit(userType))
         return Object;
     else if (userType < data->lists.size() && data->lists.testBit(userType))
@@ -1622,17 +1757,14 @@ QQmlMetaType::TypeCategory QQmlMetaType::typeCategory(int userType)
 
 bool QQmlMetaType::isInterface(int userType)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
     return userType >= 0 && userType < data->interfaces.size() && data->interfaces.testBit(userType);
 }
 
 const char *QQmlMetaType::interfaceIId(int userType)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
     QQmlType *type = data->idToType.value(userType);
-    lock.unlock();
     if (type && type->isInterface() && type->typeId() == userType)
         return type->interfaceIId();
     else
@@ -1641,8 +1773,7 @@ const char *QQmlMetaType::interfaceIId(int userType)
 
 bool QQmlMetaType::isList(int userType)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
     return userType >= 0 && userType < data->lists.size() && data->lists.testBit(userType);
 }
 
@@ -1706,8 +1837,7 @@ QQmlType *QQmlMetaType::qmlType(const QString &qualifiedName, int version_major,
 QQmlType *QQmlMetaType::qmlType(const QHashedStringRef &name, const QHashedStringRef &module, int version_major, int version_minor)
 {
     Q_ASSERT(version_major >= 0 && version_minor >= 0);
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
 
     QQmlMetaTypeData::Names::ConstIterator it = data->nameToType.constFind(name);
     while (it != data->nameToType.end() && it.key() == name) {
@@ -1726,8 +1856,7 @@ QQmlType *QQmlMetaType::qmlType(const QHashedStringRef &name, const QHashedStrin
 */
 QQmlType *QQmlMetaType::qmlType(const QMetaObject *metaObject)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
 
     return data->metaObjectToType.value(metaObject);
 }
@@ -1740,8 +1869,7 @@ QQmlType *QQmlMetaType::qmlType(const QMetaObject *metaObject)
 QQmlType *QQmlMetaType::qmlType(const QMetaObject *metaObject, const QHashedStringRef &module, int version_major, int version_minor)
 {
     Q_ASSERT(version_major >= 0 && version_minor >= 0);
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
 
     QQmlMetaTypeData::MetaObjects::const_iterator it = data->metaObjectToType.constFind(metaObject);
     while (it != data->metaObjectToType.end() && it.key() == metaObject) {
@@ -1760,8 +1888,7 @@ QQmlType *QQmlMetaType::qmlType(const QMetaObject *metaObject, const QHashedStri
 */
 QQmlType *QQmlMetaType::qmlType(int userType)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
 
     QQmlType *type = data->idToType.value(userType);
     if (type && type->typeId() == userType)
@@ -1778,8 +1905,7 @@ QQmlType *QQmlMetaType::qmlType(int userType)
 */
 QQmlType *QQmlMetaType::qmlType(const QUrl &url, bool includeNonFileImports /* = false */)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
 
     QQmlType *type = data->urlToType.value(url);
     if (!type && includeNonFileImports)
@@ -1798,8 +1924,7 @@ QQmlType *QQmlMetaType::qmlType(const QUrl &url, bool includeNonFileImports /* =
 */
 QQmlType *QQmlMetaType::qmlTypeFromIndex(int idx)
 {
-    QReadLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QQmlMetaTypeSnapshotReader data;
 
     if (idx < 0 || idx >= data->types.count())
             return 0;
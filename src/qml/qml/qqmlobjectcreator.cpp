@@ -397,6 +397,9 @@ bool QQmlPropertyCacheCreator::create(const QV4::CompiledData::Object *obj, QQml
                 propertyFlags |= QQmlPropertyData::IsQList;
         }
 
+        if (QQmlVMEMetaObject::hasTypedStorage(vmePropertyType))
+            propertyFlags |= QQmlPropertyData::IsVMEProperty;
+
         if ((!p->flags & QV4::CompiledData::Property::IsReadOnly) && p->type != QV4::CompiledData::Property::CustomList)
             propertyFlags |= QQmlPropertyData::IsWritable;
 
@@ -439,6 +442,7 @@ bool QQmlPropertyCacheCreator::create(const QV4::CompiledData::Object *obj, QQml
 
     // Alias property count.  Actual data is setup in buildDynamicMetaAliases
     ((QQmlVMEMetaData *)dynamicData.data())->aliasCount = aliasCount;
+    ((QQmlVMEMetaData *)dynamicData.data())->updateFlags();
 
     // Dynamic slot data - comes after the property data
     /*const quint32* */functionIndex = obj->functionOffsetTable();
@@ -467,6 +471,90 @@ static void removeBindingOnProperty(QObject *o, int index)
     if (binding) binding->destroy();
 }
 
+QQmlCreationDataPreparer::QQmlCreationDataPreparer(QQmlCompiledData *compiledData)
+    : QQmlCompilePass(compiledData->url, compiledData->qmlUnit)
+    , compiledData(compiledData)
+{
+}
+
+void QQmlCreationDataPreparer::prepare()
+{
+    compiledData->idMappingsForRoot = idMappings(compiledData->objectIndexToIdForRoot);
+    for (QHash<int, QHash<int, int> >::ConstIterator it = compiledData->objectIndexToIdPerComponent.constBegin(),
+         end = compiledData->objectIndexToIdPerComponent.constEnd(); it != end; ++it)
+        compiledData->idMappingsPerComponent.insert(it.key(), idMappings(it.value()));
+
+    for (quint32 i = 0; i < qmlUnit->nObjects; ++i) {
+        const QV4::CompiledData::Object *obj = qmlUnit->objectAt(i);
+        if (compiledData->isComponent(i))
+            continue;
+        if (QQmlPropertyCache *propertyCache = compiledData->propertyCaches.value(i))
+            prepareBindingValues(obj, propertyCache);
+    }
+}
+
+QVector<QQmlContextData::ObjectIdMapping> QQmlCreationDataPreparer::idMappings(const QHash<int, int> &objectIndexToId) const
+{
+    QVector<QQmlContextData::ObjectIdMapping> mapping(objectIndexToId.count());
+    for (QHash<int, int>::ConstIterator it = objectIndexToId.constBegin(), end = objectIndexToId.constEnd();
+         it != end; ++it) {
+        const QV4::CompiledData::Object *obj = qmlUnit->objectAt(it.key());
+
+        QQmlContextData::ObjectIdMapping m;
+        m.id = it.value();
+        m.name = stringAt(obj->idIndex);
+        mapping[m.id] = m;
+    }
+    return mapping;
+}
+
+void QQmlCreationDataPreparer::prepareBindingValues(const QV4::CompiledData::Object *obj, QQmlPropertyCache *propertyCache)
+{
+    PropertyResolver propertyResolver(propertyCache);
+
+    const QV4::CompiledData::Binding *binding = obj->bindingTable();
+    for (quint32 i = 0; i < obj->nBindings; ++i, ++binding) {
+        if (binding->type != QV4::CompiledData::Binding::Type_String)
+            continue;
+
+        const QString name = stringAt(binding->propertyNameIndex);
+        if (name.isEmpty())
+            continue;
+
+        QQmlPropertyData *property = propertyResolver.property(name);
+        if (!property)
+            continue;
+
+        // Only types that are parsed from their string representation and do not
+        // depend on the engine (unlike urls, which are subject to interceptors).
+        switch (property->propType) {
+        case QMetaType::QColor:
+#ifndef QT_NO_DATESTRING
+        case QMetaType::QDate:
+        case QMetaType::QTime:
+        case QMetaType::QDateTime:
+#endif
+        case QMetaType::QPoint:
+        case QMetaType::QPointF:
+        case QMetaType::QSize:
+        case QMetaType::QSizeF:
+        case QMetaType::QRect:
+        case QMetaType::QRectF:
+        case QMetaType::QVector3D:
+        case QMetaType::QVector4D: {
+            bool ok = false;
+            QVariant value = QQmlStringConverters::variantFromString(binding->valueAsString(&qmlUnit->header), property->propType, &ok);
+            // Invalid values are left to the object creator, which reports the error.
+            if (ok && value.userType() == property->propType)
+                compiledData->preparedBindingValues.insert(binding, value);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
 QmlObjectCreator::QmlObjectCreator(QQmlContextData *parentContext, QQmlCompiledData *compiledData)
     : QQmlCompilePass(compiledData->url, compiledData->qmlUnit)
     , componentAttached(0)
@@ -512,17 +600,10 @@ QObject *QmlObjectCreator::create(int subComponentIndex, QObject *parent)
     context->imports->addref();
     context->setParent(parentContext);
 
-    QVector<QQmlContextData::ObjectIdMapping> mapping(objectIndexToId.count());
-    for (QHash<int, int>::ConstIterator it = objectIndexToId.constBegin(), end = objectIndexToId.constEnd();
-         it != end; ++it) {
-        const QV4::CompiledData::Object *obj = qmlUnit->objectAt(it.key());
-
-        QQmlContextData::ObjectIdMapping m;
-        m.id = it.value();
-        m.name = stringAt(obj->idIndex);
-        mapping[m.id] = m;
-    }
-    context->setIdPropertyData(mapping);
+    if (subComponentIndex == -1)
+        context->setIdPropertyData(compiledData->idMappingsForRoot);
+    else
+        context->setIdPropertyData(compiledData->idMappingsPerComponent.value(subComponentIndex));
 
     if (subComponentIndex == -1) {
         QV4::ExecutionEngine *v4 = QV8Engine::getV4(engine);
@@ -556,6 +637,15 @@ void QmlObjectCreator::setPropertyValue(QQmlPropertyData *property, const QV4::C
     int propertyWriteStatus = -1;
     void *argv[] = { 0, 0, &propertyWriteStatus, &propertyWriteFlags };
 
+    if (binding->type == QV4::CompiledData::Binding::Type_String) {
+        QHash<const QV4::CompiledData::Binding *, QVariant>::ConstIterator prepared = compiledData->preparedBindingValues.constFind(binding);
+        if (prepared != compiledData->preparedBindingValues.constEnd() && prepared->userType() == property->propType) {
+            argv[0] = const_cast<void *>(prepared->constData());
+            QMetaObject::metacall(_qobject, QMetaObject::WriteProperty, property->coreIndex, argv);
+            return;
+        }
+    }
+
     QV4::ExecutionEngine *v4 = QV8Engine::getV4(engine);
     QV4::Scope scope(v4);
     // ### enums
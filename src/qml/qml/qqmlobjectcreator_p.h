@@ -136,6 +136,24 @@ private:
     const QHash<int, QHash<int, int> > objectIndexToIdPerComponent;
 };
 
+// Computes everything object creation needs that does not depend on a live engine
+// or object instance, i.e. the id tables of the component contexts and the typed
+// values of literal assignments that would otherwise be parsed from strings for
+// every created object. Runs on the type loader thread.
+class QQmlCreationDataPreparer : public QQmlCompilePass
+{
+public:
+    QQmlCreationDataPreparer(QQmlCompiledData *compiledData);
+
+    void prepare();
+
+private:
+    QVector<QQmlContextData::ObjectIdMapping> idMappings(const QHash<int, int> &objectIndexToId) const;
+    void prepareBindingValues(const QV4::CompiledData::Object *obj, QQmlPropertyCache *propertyCache);
+
+    QQmlCompiledData *compiledData;
+};
+
 class QmlObjectCreator : public QQmlCompilePass
 {
     Q_DECLARE_TR_FUNCTIONS(QmlObjectCreator)
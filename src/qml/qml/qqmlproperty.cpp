@@ -1474,7 +1474,10 @@ bool QQmlPropertyPrivate::writeBinding(QObject *object,
             cpptype o = (conversion); \
             int status = -1; \
             void *argv[] = { &o, 0, &status, &flags }; \
-            QMetaObject::metacall(object, QMetaObject::WriteProperty, core.coreIndex, argv); \
+            if (core.isVMEProperty()) \
+                QQmlVMEMetaObject::getForProperty(object, core.coreIndex)->writeTypedProperty(core.coreIndex, argv); \
+            else \
+                QMetaObject::metacall(object, QMetaObject::WriteProperty, core.coreIndex, argv); \
             return true; \
         } \
 
@@ -107,6 +107,7 @@ public:
         IsVarProperty      = 0x00008000, // Property type is a "var" property of VMEMO
         IsValueTypeVirtual = 0x00010000, // Property is a value type "virtual" property
         IsQVariant         = 0x00020000, // Property is a QVariant
+        IsVMEProperty      = 0x08000000, // Property was added by QML and is stored typed by the VMEMO
 
         // Apply only to IsFunctions
         IsVMEFunction      = 0x00040000, // Function was added by QML
@@ -150,6 +151,7 @@ public:
     bool isVarProperty() const { return flags & IsVarProperty; }
     bool isValueTypeVirtual() const { return flags & IsValueTypeVirtual; }
     bool isQVariant() const { return flags & IsQVariant; }
+    bool isVMEProperty() const { return flags & IsVMEProperty; }
     bool isVMEFunction() const { return flags & IsVMEFunction; }
     bool hasArguments() const { return flags & HasArguments; }
     bool isSignal() const { return flags & IsSignal; }
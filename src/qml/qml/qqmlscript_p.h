@@ -230,7 +230,7 @@ public:
     struct SignalData {
         int signalExpressionContextStack;
         Object *signalScopeObject;
-        int functionIndex; // before gen() index in functionsToCompile, then index in runtime functions
+        int functionIndex; // before gen() index in functionsToCompile, then index in runtime functions; -1 if compiled lazily
     };
     union {
         QQmlCompilerTypes::BindingReference *bindingReference;
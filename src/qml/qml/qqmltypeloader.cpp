@@ -62,6 +62,9 @@
 #include <QtCore/qdiriterator.h>
 #include <QtQml/qqmlcomponent.h>
 #include <QtCore/qwaitcondition.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qrunnable.h>
 #include <QtQml/qqmlextensioninterface.h>
 
 #if defined (Q_OS_UNIX)
@@ -150,13 +153,17 @@ public:
     void callCompleted(QQmlDataBlob *b);
     void callDownloadProgressChanged(QQmlDataBlob *b, qreal p);
     void initializeEngine(QQmlExtensionInterface *, const char *);
+    void processConcurrentParses();
 
 protected:
     virtual void shutdownThread();
 
 private:
     void loadThread(QQmlDataBlob *b);
+    void loadSyncThread(QQmlDataBlob *b);
     void loadWithStaticDataThread(QQmlDataBlob *b, const QByteArray &);
+    void loadWithStaticDataSyncThread(QQmlDataBlob *b, const QByteArray &);
+    void processConcurrentParsesThread();
     void callCompletedMain(QQmlDataBlob *b);
     void callDownloadProgressChangedMain(QQmlDataBlob *b, qreal p);
     void initializeEngineMain(QQmlExtensionInterface *iface, const char *uri);
@@ -392,6 +399,17 @@ QList<QQmlError> QQmlDataBlob::errors() const
     return m_errors;
 }
 
+/*!
+Returns the MD5 hash of the data the blob was loaded from, or an empty array if no data
+has been received yet or content hashing was not enabled on the type loader.
+
+\sa QQmlTypeLoader::enableContentHashing()
+*/
+QByteArray QQmlDataBlob::contentHash() const
+{
+    return m_contentHash;
+}
+
 /*!
 Mark this blob as having \a errors.
 
@@ -566,6 +584,30 @@ void QQmlDataBlob::allDependenciesDone()
 {
 }
 
+/*!
+Returns true if parseData() may be invoked on a loader worker thread before dataReceived().
+
+The default implementation returns false.
+*/
+bool QQmlDataBlob::supportsConcurrentParsing() const
+{
+    return false;
+}
+
+/*!
+Invoked on a loader worker thread with the received \a data, before dataReceived() is
+invoked in the load thread.  \a preparseData is the "qml:preparse" meta data of a local
+file, which dataReceived() would otherwise read from the file.  Implementors may only touch
+the blob's own state here; errors must be kept and reported from dataReceived().
+
+The default implementation does nothing.
+*/
+void QQmlDataBlob::parseData(const QByteArray &data, const QByteArray &preparseData)
+{
+    Q_UNUSED(data);
+    Q_UNUSED(preparseData);
+}
+
 /*!
 Called when the download progress of this blob changes.  \a progress goes
 from 0 to 1.
@@ -756,7 +798,7 @@ QQmlDataLoaderNetworkReplyProxy *QQmlDataLoaderThread::networkReplyProxy() const
 void QQmlDataLoaderThread::load(QQmlDataBlob *b) 
 { 
     b->addref();
-    callMethodInThread(&This::loadThread, b); 
+    callMethodInThread(&This::loadSyncThread, b); 
 }
 
 void QQmlDataLoaderThread::loadAsync(QQmlDataBlob *b)
@@ -768,7 +810,7 @@ void QQmlDataLoaderThread::loadAsync(QQmlDataBlob *b)
 void QQmlDataLoaderThread::loadWithStaticData(QQmlDataBlob *b, const QByteArray &d)
 {
     b->addref();
-    callMethodInThread(&This::loadWithStaticDataThread, b, d);
+    callMethodInThread(&This::loadWithStaticDataSyncThread, b, d);
 }
 
 void QQmlDataLoaderThread::loadWithStaticDataAsync(QQmlDataBlob *b, const QByteArray &d)
@@ -795,6 +837,11 @@ void QQmlDataLoaderThread::initializeEngine(QQmlExtensionInterface *iface,
     callMethodInMain(&This::initializeEngineMain, iface, uri);
 }
 
+void QQmlDataLoaderThread::processConcurrentParses()
+{
+    postMethodToThread(&This::processConcurrentParsesThread);
+}
+
 void QQmlDataLoaderThread::shutdownThread()
 {
     delete m_networkAccessManager;
@@ -815,6 +862,27 @@ void QQmlDataLoaderThread::loadWithStaticDataThread(QQmlDataBlob *b, const QByte
     b->release();
 }
 
+// Synchronous loads must not return to the caller while parts of the
+// dependency tree are still being parsed by loader workers.
+void QQmlDataLoaderThread::loadSyncThread(QQmlDataBlob *b)
+{
+    m_loader->loadThread(b);
+    m_loader->processConcurrentParses(true);
+    b->release();
+}
+
+void QQmlDataLoaderThread::loadWithStaticDataSyncThread(QQmlDataBlob *b, const QByteArray &d)
+{
+    m_loader->loadWithStaticDataThread(b, d);
+    m_loader->processConcurrentParses(true);
+    b->release();
+}
+
+void QQmlDataLoaderThread::processConcurrentParsesThread()
+{
+    m_loader->processConcurrentParses(false);
+}
+
 void QQmlDataLoaderThread::callCompletedMain(QQmlDataBlob *b) 
 { 
     QML_MEMORY_SCOPE_URL(b->url());
@@ -870,14 +938,49 @@ one of these three preconditions are met.
 \endlist
 
 Thus QQmlDataBlob::done() will always eventually be called, even if the blob has an error set.
+
+Blobs that support it have their data parsed by a pool of loader worker threads through
+QQmlDataBlob::parseData() before dataReceived() is invoked in the load thread.  The number
+of workers defaults to one less than the number of cores and can be set with the
+QML_LOADER_THREADS environment variable; 0 parses everything in the load thread.
 */
 
+class QQmlDataLoaderParseJob : public QRunnable
+{
+public:
+    QQmlDataLoaderParseJob(QQmlDataLoader *loader, QQmlDataBlob *blob, const QByteArray &data,
+                           const QByteArray &preparseData)
+        : m_loader(loader), m_blob(blob), m_data(data), m_preparseData(preparseData) {}
+
+    virtual void run() { m_loader->parseConcurrently(m_blob, m_data, m_preparseData); }
+
+private:
+    QQmlDataLoader *m_loader;
+    QQmlDataBlob *m_blob;
+    QByteArray m_data;
+    QByteArray m_preparseData;
+};
+
+static int qmlLoaderWorkerCount()
+{
+    bool ok = false;
+    int count = qgetenv("QML_LOADER_THREADS").toInt(&ok);
+    if (!ok)
+        count = QThread::idealThreadCount() - 1;
+    return count;
+}
+
 /*!
 Create a new QQmlDataLoader for \a engine.
 */
 QQmlDataLoader::QQmlDataLoader(QQmlEngine *engine)
-: m_engine(engine), m_thread(new QQmlDataLoaderThread(this))
+: m_engine(engine), m_thread(new QQmlDataLoaderThread(this)), m_parserPool(0), m_pendingParses(0)
 {
+    int workers = qmlLoaderWorkerCount();
+    if (workers > 0) {
+        m_parserPool = new QThreadPool;
+        m_parserPool->setMaxThreadCount(workers);
+    }
 }
 
 /*! \internal */
@@ -888,6 +991,7 @@ QQmlDataLoader::~QQmlDataLoader()
 
     shutdownThread();
     delete m_thread;
+    delete m_parserPool;
 }
 
 void QQmlDataLoader::lock()
@@ -1022,7 +1126,10 @@ void QQmlDataLoader::loadThread(QQmlDataBlob *blob)
         if (blob->m_data.isAsync())
             m_thread->callDownloadProgressChanged(blob, 1.);
 
-        setData(blob, &file);
+        if (m_parserPool && blob->supportsConcurrentParsing())
+            setDataConcurrently(blob, file.dataByteArray(), file.metaData(QLatin1String("qml:preparse")));
+        else
+            setData(blob, &file);
 
     } else {
 
@@ -1082,7 +1189,10 @@ void QQmlDataLoader::networkReplyFinished(QNetworkReply *reply)
         blob->networkError(reply->error());
     } else {
         QByteArray data = reply->readAll();
-        setData(blob, data);
+        if (m_parserPool && blob->supportsConcurrentParsing())
+            setDataConcurrently(blob, data);
+        else
+            setData(blob, data);
     }
 
     blob->release();
@@ -1152,6 +1262,10 @@ void QQmlDataLoader::setData(QQmlDataBlob *blob, const QQmlDataBlob::Data &d)
     QML_MEMORY_SCOPE_URL(blob->url());
     blob->m_inCallback = true;
 
+    if (m_contentHashUsers.load())
+        blob->m_contentHash = QCryptographicHash::hash(QByteArray::fromRawData(d.data(), d.size()),
+                                                       QCryptographicHash::Md5);
+
     blob->dataReceived(d);
 
     if (!blob->isError() && !blob->isWaiting())
@@ -1165,8 +1279,86 @@ void QQmlDataLoader::setData(QQmlDataBlob *blob, const QQmlDataBlob::Data &d)
     blob->tryDone();
 }
 
+/*
+Hands \a blob to a loader worker for parsing.  dataReceived() is invoked later in the
+load thread, from processConcurrentParses().
+*/
+void QQmlDataLoader::setDataConcurrently(QQmlDataBlob *blob, const QByteArray &data,
+                                         const QByteArray &preparseData)
+{
+    ASSERT_LOADTHREAD();
+    Q_ASSERT(m_parserPool && blob->supportsConcurrentParsing());
+
+    // Resolve lazily computed state here so that the worker only reads it.
+    blob->finalUrlString();
+
+    blob->addref();
+    {
+        QMutexLocker locker(&m_parsedMutex);
+        ++m_pendingParses;
+    }
+    m_parserPool->start(new QQmlDataLoaderParseJob(this, blob, data, preparseData));
+}
+
+void QQmlDataLoader::parseConcurrently(QQmlDataBlob *blob, const QByteArray &data,
+                                       const QByteArray &preparseData)
+{
+    blob->parseData(data, preparseData);
+
+    QMutexLocker locker(&m_parsedMutex);
+    bool wasEmpty = m_parsed.isEmpty();
+    m_parsed.append(qMakePair(blob, data));
+    m_parsedCondition.wakeAll();
+    locker.unlock();
+
+    if (wasEmpty)
+        m_thread->processConcurrentParses();
+}
+
+/*
+Feeds blobs parsed by the loader workers back into the usual dataReceived() and
+dependency handling.  If \a waitForPending is true, this returns only once no parses
+are outstanding, including the ones started by the dependencies found on the way.
+*/
+void QQmlDataLoader::processConcurrentParses(bool waitForPending)
+{
+    ASSERT_LOADTHREAD();
+
+    QMutexLocker locker(&m_parsedMutex);
+    while (true) {
+        while (waitForPending && m_parsed.isEmpty() && m_pendingParses)
+            m_parsedCondition.wait(&m_parsedMutex);
+
+        if (m_parsed.isEmpty())
+            return;
+
+        ParsedBlobs parsed;
+        parsed.swap(m_parsed);
+        m_pendingParses -= parsed.count();
+        locker.unlock();
+
+        for (int ii = 0; ii < parsed.count(); ++ii) {
+            QQmlDataBlob *blob = parsed.at(ii).first;
+            setData(blob, parsed.at(ii).second);
+            blob->release();
+        }
+
+        locker.relock();
+    }
+}
+
 void QQmlDataLoader::shutdownThread()
 {
+    if (m_parserPool) {
+        m_parserPool->waitForDone();
+
+        QMutexLocker locker(&m_parsedMutex);
+        for (int ii = 0; ii < m_parsed.count(); ++ii)
+            m_parsed.at(ii).first->release();
+        m_parsed.clear();
+        m_pendingParses = 0;
+    }
+
     if (!m_thread->isShutdown())
         m_thread->shutdown();
 }
@@ -1237,6 +1429,48 @@ bool QQmlTypeLoader::Blob::updateQmldir(QQmlQmldirData *data, const QQmlScript::
     return true;
 }
 
+/*
+Loads the plugins of the local modules among \a imports on the loader workers, so that
+the addImport() calls that follow only have to register their types.  Nothing is done
+unless at least two plugins are still to be loaded.
+
+Returns the paths of the plugins, which have to be passed to
+QQmlImportDatabase::releasePreloadedPlugins() once the imports have been processed.
+*/
+QStringList QQmlTypeLoader::Blob::preloadPlugins(const QList<QQmlScript::Import> &imports)
+{
+    QThreadPool *pool = typeLoader()->workerPool();
+    if (!pool || imports.count() < 2)
+        return QStringList();
+
+    QQmlImportDatabase *importDatabase = typeLoader()->importDatabase();
+
+    QStringList pluginPaths;
+    foreach (const QQmlScript::Import &import, imports) {
+        if (import.type != QQmlScript::Import::Library
+                || QQmlMetaType::isLockedModule(import.uri, import.majorVersion))
+            continue;
+
+        QString qmldirFilePath;
+        QString qmldirUrl;
+        if (!m_imports.locateQmldir(importDatabase, import.uri, import.majorVersion, import.minorVersion,
+                                    &qmldirFilePath, &qmldirUrl))
+            continue;
+
+        const QmldirContent *qmldir = typeLoader()->qmldirContent(qmldirFilePath, qmldirUrl);
+        if (qmldir->hasError())
+            continue;
+
+        foreach (const QString &path, importDatabase->pluginsToPreload(typeLoader(), qmldirFilePath, qmldir->plugins())) {
+            if (!pluginPaths.contains(path))
+                pluginPaths.append(path);
+        }
+    }
+
+    importDatabase->preloadPlugins(pluginPaths, pool);
+    return pluginPaths;
+}
+
 bool QQmlTypeLoader::Blob::addImport(const QQmlScript::Import &import, QList<QQmlError> *errors)
 {
     Q_ASSERT(errors);
@@ -1863,6 +2097,8 @@ const QQmlTypeLoader::QmldirContent *QQmlTypeLoader::qmldirContent(const QString
                 } else {
                     data += file.readAll();
                     qmldir->setContent(filePath, QString::fromUtf8(data));
+                    // Only plain files are hashed; a bundle's location is the whole bundle.
+                    qmldir->m_contentHash = QCryptographicHash::hash(data, QCryptographicHash::Md5);
                 }
             } else {
                 ERROR(NOT_READABLE_ERROR.arg(filePath));
@@ -1945,6 +2181,190 @@ void QQmlTypeLoader::trimCache()
     // TODO: release any scripts which are no longer referenced by any types
 }
 
+static QByteArray fileContentHash(const QString &filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QFile::ReadOnly))
+        return QByteArray();
+    return QCryptographicHash::hash(file.readAll(), QCryptographicHash::Md5);
+}
+
+static bool fileContentChanged(const QString &filePath, const QByteArray &hash)
+{
+    return fileContentHash(filePath) != hash;
+}
+
+/*!
+Clears the cached type data and scripts of local files whose content changed since they
+were loaded, together with everything that depends on them, and returns their URLs.
+Only files loaded or seen while content hashing is enabled are checked.
+
+Unlike clearCache(), components that did not change keep their compiled data, so loading
+a document again only recompiles what is affected by the change.  If a qmldir file
+changed, type resolution may have changed everywhere and the whole cache is cleared.
+*/
+QList<QUrl> QQmlTypeLoader::clearChangedFiles()
+{
+    QList<QUrl> cleared;
+
+    for (ImportQmlDirCache::ConstIterator iter = m_importQmlDirCache.begin(); iter != m_importQmlDirCache.end(); ++iter) {
+        const QmldirContent *qmldir = *iter;
+        if (qmldir->m_contentHash.isEmpty() || !QFile::exists(qmldir->m_location))
+            continue;
+        if (fileContentChanged(qmldir->m_location, qmldir->m_contentHash)) {
+            cleared << m_typeCache.keys() << m_scriptCache.keys();
+            clearCache();
+            return cleared;
+        }
+    }
+
+    QSet<QQmlDataBlob *> changed;
+    for (TypeCache::ConstIterator iter = m_typeCache.constBegin(); iter != m_typeCache.constEnd(); ++iter) {
+        QQmlTypeData *typeData = *iter;
+        if (typeData->isError()) {
+            changed.insert(typeData);
+            continue;
+        }
+        if (!typeData->isComplete() || typeData->m_contentHash.isEmpty())
+            continue;
+        const QString path = QQmlFile::urlToLocalFileOrQrc(typeData->finalUrl());
+        if (!path.isEmpty() && fileContentChanged(path, typeData->m_contentHash))
+            changed.insert(typeData);
+    }
+    for (ScriptCache::ConstIterator iter = m_scriptCache.constBegin(); iter != m_scriptCache.constEnd(); ++iter) {
+        QQmlScriptBlob *script = *iter;
+        if (script->isError()) {
+            changed.insert(script);
+            continue;
+        }
+        if (!script->isComplete() || script->m_contentHash.isEmpty())
+            continue;
+        const QString path = QQmlFile::urlToLocalFileOrQrc(script->finalUrl());
+        if (!path.isEmpty() && fileContentChanged(path, script->m_contentHash))
+            changed.insert(script);
+    }
+
+    // Everything that depends on a changed file has to be recompiled as well.
+    bool grown = !changed.isEmpty();
+    while (grown) {
+        grown = false;
+        for (TypeCache::ConstIterator iter = m_typeCache.constBegin(); iter != m_typeCache.constEnd(); ++iter) {
+            QQmlTypeData *typeData = *iter;
+            if (changed.contains(typeData))
+                continue;
+            bool affected = false;
+            foreach (const QQmlTypeData::TypeReference &type, typeData->m_types)
+                affected |= type.typeData && changed.contains(type.typeData);
+            foreach (const QQmlTypeData::TypeReference &type, typeData->m_compositeSingletons)
+                affected |= type.typeData && changed.contains(type.typeData);
+            foreach (const QQmlTypeData::ScriptReference &script, typeData->m_scripts)
+                affected |= changed.contains(script.script);
+            if (affected) {
+                changed.insert(typeData);
+                grown = true;
+            }
+        }
+        for (ScriptCache::ConstIterator iter = m_scriptCache.constBegin(); iter != m_scriptCache.constEnd(); ++iter) {
+            QQmlScriptBlob *script = *iter;
+            if (changed.contains(script))
+                continue;
+            bool affected = false;
+            foreach (const QQmlScriptBlob::ScriptReference &import, script->m_scripts)
+                affected |= changed.contains(import.script);
+            if (affected) {
+                changed.insert(script);
+                grown = true;
+            }
+        }
+    }
+
+    for (TypeCache::Iterator iter = m_typeCache.begin(); iter != m_typeCache.end();) {
+        if (changed.contains(*iter)) {
+            cleared << iter.key();
+            (*iter)->release();
+            iter = m_typeCache.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    for (ScriptCache::Iterator iter = m_scriptCache.begin(); iter != m_scriptCache.end();) {
+        if (changed.contains(*iter)) {
+            cleared << iter.key();
+            (*iter)->release();
+            iter = m_scriptCache.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    // Directory listings are cheap to rebuild and may have gained or lost files.
+    qDeleteAll(m_importDirCache);
+    m_importDirCache.clear();
+
+    return cleared;
+}
+
+/*!
+Returns the local paths of the documents and scripts currently held in the cache.
+*/
+QStringList QQmlTypeLoader::cachedLocalFiles() const
+{
+    QStringList files;
+    for (TypeCache::ConstIterator iter = m_typeCache.constBegin(); iter != m_typeCache.constEnd(); ++iter) {
+        const QString path = QQmlFile::urlToLocalFileOrQrc((*iter)->finalUrl());
+        if (!path.isEmpty() && !path.startsWith(QLatin1Char(':')))
+            files << path;
+    }
+    for (ScriptCache::ConstIterator iter = m_scriptCache.constBegin(); iter != m_scriptCache.constEnd(); ++iter) {
+        const QString path = QQmlFile::urlToLocalFileOrQrc((*iter)->finalUrl());
+        if (!path.isEmpty() && !path.startsWith(QLatin1Char(':')))
+            files << path;
+    }
+    for (ImportQmlDirCache::ConstIterator iter = m_importQmlDirCache.begin(); iter != m_importQmlDirCache.end(); ++iter) {
+        const QString &location = (*iter)->m_location;
+        if (!location.isEmpty() && QFile::exists(location))
+            files << location;
+    }
+    return files;
+}
+
+/*!
+Starts hashing the content of loaded files, which clearChangedFiles() compares against.
+
+Files that were loaded while hashing was disabled are hashed as they are on disk now.
+Calls must be balanced with disableContentHashing().
+*/
+void QQmlTypeLoader::enableContentHashing()
+{
+    LockHolder<QQmlTypeLoader> holder(this);
+    m_contentHashUsers.ref();
+
+    for (TypeCache::ConstIterator iter = m_typeCache.constBegin(); iter != m_typeCache.constEnd(); ++iter) {
+        QQmlTypeData *typeData = *iter;
+        if (!typeData->isComplete() || !typeData->m_contentHash.isEmpty())
+            continue;
+        const QString path = QQmlFile::urlToLocalFileOrQrc(typeData->finalUrl());
+        if (!path.isEmpty())
+            typeData->m_contentHash = fileContentHash(path);
+    }
+    for (ScriptCache::ConstIterator iter = m_scriptCache.constBegin(); iter != m_scriptCache.constEnd(); ++iter) {
+        QQmlScriptBlob *script = *iter;
+        if (!script->isComplete() || !script->m_contentHash.isEmpty())
+            continue;
+        const QString path = QQmlFile::urlToLocalFileOrQrc(script->finalUrl());
+        if (!path.isEmpty())
+            script->m_contentHash = fileContentHash(path);
+    }
+}
+
+/*!
+Stops hashing the content of loaded files once no user needs it any more.
+*/
+void QQmlTypeLoader::disableContentHashing()
+{
+    m_contentHashUsers.deref();
+}
+
 bool QQmlTypeLoader::isTypeLoaded(const QUrl &url) const
 {
     LockHolder<QQmlTypeLoader> holder(const_cast<QQmlTypeLoader *>(this));
@@ -1963,7 +2383,8 @@ QQmlTypeData::TypeDataCallback::~TypeDataCallback()
 
 QQmlTypeData::QQmlTypeData(const QUrl &url, QQmlTypeLoader *manager)
 : QQmlTypeLoader::Blob(url, QmlFile, manager),
-   m_typesResolved(false), m_compiledData(0), m_implicitImport(0), m_implicitImportLoaded(false)
+   m_typesResolved(false), m_parsedConcurrently(false), m_compiledData(0), m_implicitImport(0),
+   m_implicitImportLoaded(false)
 {
     m_useNewCompiler = QQmlEnginePrivate::get(manager->engine())->useNewCompiler;
 }
@@ -2146,23 +2567,54 @@ bool QQmlTypeData::loadImplicitImport()
     return true;
 }
 
-void QQmlTypeData::dataReceived(const Data &data)
+bool QQmlTypeData::parse(const QString &code, const QByteArray &preparseData, QList<QQmlError> *errors)
 {
-    QString code = QString::fromUtf8(data.data(), data.size());
-    QByteArray preparseData;
-
-    if (data.isFile()) preparseData = data.asFile()->metaData(QLatin1String("qml:preparse"));
-
     if (m_useNewCompiler) {
         parsedQML.reset(new QtQml::ParsedQML(QV8Engine::getV4(typeLoader()->engine())->debugger != 0));
         QQmlCodeGenerator compiler;
         if (!compiler.generateFromQml(code, finalUrl(), finalUrlString(), parsedQML.data())) {
-            setError(compiler.errors);
-            return;
+            *errors = compiler.errors;
+            return false;
         }
     } else {
         if (!scriptParser.parse(code, preparseData, finalUrl(), finalUrlString())) {
-            setError(scriptParser.errors());
+            *errors = scriptParser.errors();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool QQmlTypeData::supportsConcurrentParsing() const
+{
+    return true;
+}
+
+void QQmlTypeData::parseData(const QByteArray &data, const QByteArray &preparseData)
+{
+    QString code = QString::fromUtf8(data.constData(), data.size());
+    parse(code, preparseData, &m_parseErrors);
+    m_parsedConcurrently = true;
+}
+
+void QQmlTypeData::dataReceived(const Data &data)
+{
+    if (m_parsedConcurrently) {
+        m_parsedConcurrently = false;
+        if (!m_parseErrors.isEmpty()) {
+            setError(m_parseErrors);
+            m_parseErrors.clear();
+            return;
+        }
+    } else {
+        QString code = QString::fromUtf8(data.data(), data.size());
+        QByteArray preparseData;
+
+        if (data.isFile()) preparseData = data.asFile()->metaData(QLatin1String("qml:preparse"));
+
+        QList<QQmlError> parseErrors;
+        if (!parse(code, preparseData, &parseErrors)) {
+            setError(parseErrors);
             return;
         }
     }
@@ -2218,8 +2670,12 @@ void QQmlTypeData::dataReceived(const Data &data)
         }
     }
 
-    foreach (const QQmlScript::Import &import, m_useNewCompiler ? m_newImports : scriptParser.imports()) {
+    const QList<QQmlScript::Import> importList = m_useNewCompiler ? m_newImports : scriptParser.imports();
+    const QStringList preloadedPlugins = preloadPlugins(importList);
+
+    foreach (const QQmlScript::Import &import, importList) {
         if (!addImport(import, &errors)) {
+            typeLoader()->importDatabase()->releasePreloadedPlugins(preloadedPlugins);
             Q_ASSERT(errors.size());
             QQmlError error(errors.takeFirst());
             error.setUrl(m_imports.baseUrl());
@@ -2231,6 +2687,8 @@ void QQmlTypeData::dataReceived(const Data &data)
         }
     }
 
+    typeLoader()->importDatabase()->releasePreloadedPlugins(preloadedPlugins);
+
     // ### convert to use new data structure once old compiler is gone.
     if (m_useNewCompiler && m_newPragmas.isEmpty()) {
         m_newPragmas.reserve(parsedQML->pragmas.size());
@@ -2379,6 +2837,7 @@ void QQmlTypeData::compile()
 
         QScopedPointer<QQmlJS::EvalInstructionSelection> isel(v4->iselFactory->create(enginePrivate, v4->executableAllocator, &parsedQML->jsModule, &parsedQML->jsGenerator));
         isel->setUseFastLookups(false);
+        isel->setUseFastMemberLookups(true);
         QV4::CompiledData::CompilationUnit *jsUnit = isel->compile(/*generated unit data*/false);
 
         // Generate QML compiled type data structures
@@ -2471,6 +2930,11 @@ void QQmlTypeData::compile()
                 errors << validator.errors;
         }
 
+        if (errors.isEmpty()) {
+            QQmlCreationDataPreparer preparer(m_compiledData);
+            preparer.prepare();
+        }
+
         if (!errors.isEmpty()) {
             setError(errors);
             m_compiledData->release();
@@ -2882,8 +3346,11 @@ void QQmlScriptBlob::dataReceived(const Data &data)
 
     QList<QQmlError> errors;
 
+    const QStringList preloadedPlugins = preloadPlugins(m_metadata.imports);
+
     foreach (const QQmlScript::Import &import, m_metadata.imports) {
         if (!addImport(import, &errors)) {
+            typeLoader()->importDatabase()->releasePreloadedPlugins(preloadedPlugins);
             Q_ASSERT(errors.size());
             QQmlError error(errors.takeFirst());
             error.setUrl(m_imports.baseUrl());
@@ -2894,6 +3361,8 @@ void QQmlScriptBlob::dataReceived(const Data &data)
             return;
         }
     }
+
+    typeLoader()->importDatabase()->releasePreloadedPlugins(preloadedPlugins);
 }
 
 void QQmlScriptBlob::done()
@@ -55,6 +55,8 @@
 
 #include <QtCore/qobject.h>
 #include <QtCore/qatomic.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qwaitcondition.h>
 #include <QtNetwork/qnetworkreply.h>
 #include <QtQml/qqmlerror.h>
 #include <QtQml/qqmlengine.h>
@@ -83,6 +85,7 @@ class QQmlComponentPrivate;
 class QQmlTypeData;
 class QQmlDataLoader;
 class QQmlExtensionInterface;
+class QThreadPool;
 
 namespace QtQml {
 struct ParsedQML;
@@ -128,6 +131,8 @@ public:
 
     QList<QQmlError> errors() const;
 
+    QByteArray contentHash() const;
+
     class Data {
     public:
         inline const char *data() const;
@@ -164,9 +169,15 @@ protected:
     // Callbacks made in main thread
     virtual void downloadProgressChanged(qreal);
     virtual void completed();
+
+    // Called in load thread to decide whether parseData() may be used
+    virtual bool supportsConcurrentParsing() const;
+    // Callback made in a loader worker thread, before dataReceived()
+    virtual void parseData(const QByteArray &, const QByteArray &);
 private:
     friend class QQmlDataLoader;
     friend class QQmlDataLoaderThread;
+    friend class QQmlTypeLoader;
 
     void tryDone();
     void cancelAllWaitingFor();
@@ -199,6 +210,10 @@ private:
     QUrl m_finalUrl;
     mutable QString m_finalUrlString;
 
+    // Hash of the data the blob was created from, used to detect changed files.
+    // Only computed while content hashing is enabled on the loader.
+    QByteArray m_contentHash;
+
     // List of QQmlDataBlob's that are waiting for me to complete.
     QList<QQmlDataBlob *> m_waitingOnMe;
 
@@ -235,6 +250,11 @@ public:
 protected:
     void shutdownThread();
 
+    QThreadPool *workerPool() const { return m_parserPool; }
+
+    // Number of users that need the content hashes of loaded blobs
+    QAtomicInt m_contentHashUsers;
+
 private:
     friend class QQmlDataBlob;
     friend class QQmlDataLoaderThread;
@@ -251,9 +271,23 @@ private:
     void setData(QQmlDataBlob *, QQmlFile *);
     void setData(QQmlDataBlob *, const QQmlDataBlob::Data &);
 
+    friend class QQmlDataLoaderParseJob;
+    void setDataConcurrently(QQmlDataBlob *, const QByteArray &, const QByteArray & = QByteArray());
+    void parseConcurrently(QQmlDataBlob *, const QByteArray &, const QByteArray &);
+    void processConcurrentParses(bool waitForPending);
+
     QQmlEngine *m_engine;
     QQmlDataLoaderThread *m_thread;
     NetworkReplies m_networkReplies;
+
+    // Worker threads that parse blobs concurrently. Everything else,
+    // including dependency tracking, stays on the load thread.
+    typedef QList<QPair<QQmlDataBlob *, QByteArray> > ParsedBlobs;
+    QThreadPool *m_parserPool;
+    QMutex m_parsedMutex;
+    QWaitCondition m_parsedCondition;
+    ParsedBlobs m_parsed;
+    int m_pendingParses;
 };
 
 class QQmlBundleData : public QQmlBundle,
@@ -278,6 +312,7 @@ public:
         const QQmlImports &imports() const { return m_imports; }
 
     protected:
+        QStringList preloadPlugins(const QList<QQmlScript::Import> &imports);
         bool addImport(const QQmlScript::Import &import, QList<QQmlError> *errors);
         bool addPragma(const QQmlScript::Pragma &pragma, QList<QQmlError> *errors);
 
@@ -324,6 +359,7 @@ public:
     private:
         QQmlDirParser m_parser;
         QString m_location;
+        QByteArray m_contentHash;
     };
 
     QQmlTypeLoader(QQmlEngine *);
@@ -349,6 +385,10 @@ public:
 
     void clearCache();
     void trimCache();
+    QList<QUrl> clearChangedFiles();
+    QStringList cachedLocalFiles() const;
+    void enableContentHashing();
+    void disableContentHashing();
 
     bool isTypeLoaded(const QUrl &url) const;
     bool isScriptLoaded(const QUrl &url) const;
@@ -448,7 +488,11 @@ protected:
     virtual void allDependenciesDone();
     virtual void downloadProgressChanged(qreal);
 
+    virtual bool supportsConcurrentParsing() const;
+    virtual void parseData(const QByteArray &, const QByteArray &);
+
 private:
+    bool parse(const QString &code, const QByteArray &preparseData, QList<QQmlError> *errors);
     void resolveTypes();
     void compile();
     bool resolveType(const QQmlScript::TypeReference *parserRef, int &majorVersion, int &minorVersion, TypeReference &ref);
@@ -476,6 +520,9 @@ private:
     // ---
     bool m_typesResolved:1;
     bool m_useNewCompiler:1;
+    // Written by a loader worker, so it must not share storage with the bits above.
+    bool m_parsedConcurrently;
+    QList<QQmlError> m_parseErrors;
 
     QQmlCompiledData *m_compiledData;
 
@@ -135,12 +135,13 @@ bool QQmlVME::initDeferred(QObject *object)
 {
     QQmlData *data = QQmlData::get(object);
 
-    if (!data || !data->deferredData)
+    QQmlData::DeferredData *deferred = data ? data->deferredData() : 0;
+    if (!deferred)
         return false;
 
-    QQmlContextData *ctxt = data->deferredData->context;
-    QQmlCompiledData *comp = data->deferredData->compiledData;
-    int start = data->deferredData->deferredIdx;
+    QQmlContextData *ctxt = deferred->context;
+    QQmlCompiledData *comp = deferred->compiledData;
+    int start = deferred->deferredIdx;
 
     State initState;
     initState.flags = State::Deferred;
@@ -578,6 +579,7 @@ QObject *QQmlVME::run(QList<QQmlError> *errors,
             QQmlData *ddata = new (memory) QQmlData;
             ddata->ownMemory = false;
             QObjectPrivate::get(o)->declarativeData = ddata;
+            QQmlData::objectCreated(o);
 
             if (rootContext && rootContext->isRootObjectInCreation) {
                 ddata->rootObjectInCreation = true;
@@ -651,6 +653,7 @@ QObject *QQmlVME::run(QList<QQmlError> *errors,
             ddata->columnNumber = instr.column;
 
             QObjectPrivate::get(o)->declarativeData = ddata;                                                      
+            QQmlData::objectCreated(o);
             ddata->context = ddata->outerContext = CTXT;
             ddata->nextContextObject = CTXT->contextObjects; 
             if (ddata->nextContextObject) 
@@ -777,16 +780,26 @@ QObject *QQmlVME::run(QList<QQmlError> *errors,
             QObject *target = objects.top();
             QObject *context = objects.at(objects.count() - 1 - instr.context);
 
-            QV4::ExecutionContext *qmlContext = qmlBindingContext(engine, QV8Engine::getV4(engine), qmlBindingWrappers, CTXT, context, objects.count() - 1 - instr.context);
+            QQmlBoundSignalExpression *expr;
+            if (instr.lazyFunctionIndex != -1) {
+                expr = new QQmlBoundSignalExpression(target, instr.signalIndex,
+                                                     CTXT, context, PRIMITIVES.at(instr.value),
+                                                     COMP->name, instr.line, instr.column,
+                                                     PRIMITIVES.at(instr.handlerName),
+                                                     PRIMITIVES.at(instr.parameters),
+                                                     COMP, instr.lazyFunctionIndex);
+            } else {
+                QV4::ExecutionContext *qmlContext = qmlBindingContext(engine, QV8Engine::getV4(engine), qmlBindingWrappers, CTXT, context, objects.count() - 1 - instr.context);
 
-            QV4::Function *runtimeFunction = COMP->compilationUnit->runtimeFunctions[instr.runtimeFunctionIndex];
+                QV4::Function *runtimeFunction = COMP->compilationUnit->runtimeFunctions[instr.runtimeFunctionIndex];
 
-            tmpValue = QV4::FunctionObject::creatScriptFunction(qmlContext, runtimeFunction);
+                tmpValue = QV4::FunctionObject::creatScriptFunction(qmlContext, runtimeFunction);
+
+                expr = new QQmlBoundSignalExpression(target, instr.signalIndex,
+                                                     CTXT, context, tmpValue);
+            }
 
             QQmlBoundSignal *bs = new QQmlBoundSignal(target, instr.signalIndex, target, engine);
-            QQmlBoundSignalExpression *expr =
-                new QQmlBoundSignalExpression(target, instr.signalIndex,
-                                              CTXT, context, tmpValue);
             bs->takeExpression(expr);
         QML_END_INSTR(StoreSignal)
 
@@ -991,19 +1004,21 @@ QObject *QQmlVME::run(QList<QQmlError> *errors,
             if (instr.deferCount) {
                 QObject *target = objects.top();
                 QQmlData *data = QQmlData::get(target, true);
-                if (data->deferredData) {
+                QQmlData::DeferredData *deferred = data->deferredData();
+                if (deferred) {
                     //This rare case still won't always work right
                     qmlInfo(target) << "Setting deferred property across multiple components may not work";
-                    delete data->deferredData;
+                    delete deferred;
                 }
-                data->deferredData = new QQmlData::DeferredData;
+                deferred = new QQmlData::DeferredData;
                 //If we're in a CreateQML here, data->compiledData could be reset later
-                data->deferredData->compiledData = COMP;
-                data->deferredData->context = CTXT;
+                deferred->compiledData = COMP;
+                deferred->context = CTXT;
                 // Keep this data referenced until we're initialized
-                data->deferredData->compiledData->addref();
-                data->deferredData->deferredIdx = INSTRUCTIONSTREAM - COMP->bytecode.constData();
-                Q_ASSERT(data->deferredData->deferredIdx != 0);
+                deferred->compiledData->addref();
+                deferred->deferredIdx = INSTRUCTIONSTREAM - COMP->bytecode.constData();
+                Q_ASSERT(deferred->deferredIdx != 0);
+                data->setDeferredData(deferred);
                 INSTRUCTIONSTREAM += instr.deferCount;
             }
         QML_END_INSTR(Defer)
@@ -558,6 +558,33 @@ QAbstractDynamicMetaObject *QQmlVMEMetaObject::toDynamicMetaObject(QObject *o)
     return this;
 }
 
+/*
+Records the parts of the storage setup of a QQmlVMEMetaObject that only depend on the
+property types, so that they needn't be worked out again for every instance.  Called by
+the compilers once the property data has been written.
+*/
+void QQmlVMEMetaData::updateFlags()
+{
+    int list_type = qMetaTypeId<QQmlListProperty<QObject> >();
+    int qobject_type = qMetaTypeId<QObject*>();
+    int variant_type = qMetaTypeId<QVariant>();
+
+    flags = 0;
+    // Need JS wrapper to ensure variant and var properties are marked.
+    // ### FIXME: I hope that this can be removed once we have the proper scope chain
+    // set up and the JS wrappers always exist.
+    if (varPropertyCount > 0)
+        flags |= NeedsJSWrapper;
+
+    for (int ii = 0; ii < propertyCount - varPropertyCount; ++ii) {
+        int t = (propertyData() + ii)->propertyType;
+        if (t == list_type)
+            flags |= HasListProperties;
+        else if (t == qobject_type || t == variant_type)
+            flags |= NeedsJSWrapper;
+    }
+}
+
 QQmlVMEMetaObject::QQmlVMEMetaObject(QObject *obj,
                                      QQmlPropertyCache *cache,
                                      const QQmlVMEMetaData *meta, QV4::ExecutionContext *qmlBindingContext, QQmlCompiledData *compiledData)
@@ -581,28 +608,19 @@ QQmlVMEMetaObject::QQmlVMEMetaObject(QObject *obj,
     data = new QQmlVMEVariant[metaData->propertyCount - metaData->varPropertyCount];
 
     aConnected.resize(metaData->aliasCount);
-    int list_type = qMetaTypeId<QQmlListProperty<QObject> >();
-    int qobject_type = qMetaTypeId<QObject*>();
-    int variant_type = qMetaTypeId<QVariant>();
-    // Need JS wrapper to ensure variant and var properties are marked.
-    // ### FIXME: I hope that this can be removed once we have the proper scope chain
-    // set up and the JS wrappers always exist.
-    bool needsJSWrapper = (metaData->varPropertyCount > 0);
-
-    // ### Optimize
-    for (int ii = 0; ii < metaData->propertyCount - metaData->varPropertyCount; ++ii) {
-        int t = (metaData->propertyData() + ii)->propertyType;
-        if (t == list_type) {
-            listProperties.append(List(methodOffset() + ii, this));
-            data[ii].setValue(listProperties.count() - 1);
-        } else if (!needsJSWrapper && (t == qobject_type || t == variant_type)) {
-            needsJSWrapper = true;
+    if (metaData->flags & QQmlVMEMetaData::HasListProperties) {
+        int list_type = qMetaTypeId<QQmlListProperty<QObject> >();
+        for (int ii = 0; ii < metaData->propertyCount - metaData->varPropertyCount; ++ii) {
+            if ((metaData->propertyData() + ii)->propertyType == list_type) {
+                listProperties.append(List(methodOffset() + ii, this));
+                data[ii].setValue(listProperties.count() - 1);
+            }
         }
     }
 
     firstVarPropertyIndex = metaData->propertyCount - metaData->varPropertyCount;
 
-    if (needsJSWrapper)
+    if (metaData->flags & QQmlVMEMetaData::NeedsJSWrapper)
         ensureQObjectWrapper();
 
     if (qmlBindingContext && metaData->methodCount) {
@@ -1193,6 +1211,90 @@ void QQmlVMEMetaObject::setVmeMethod(int index, QV4::ValueRef function)
     v8methods[methodIndex] = function;
 }
 
+/*
+Reads the QML-declared property \a coreIndex into \a value without going through
+metaCall().  The property must have been flagged QQmlPropertyData::IsVMEProperty,
+and \a value must point to the C++ type of its storage.
+*/
+void QQmlVMEMetaObject::readTypedProperty(int coreIndex, void *value)
+{
+    int id = coreIndex - propOffset();
+    Q_ASSERT(id >= 0 && id < firstVarPropertyIndex);
+
+    switch ((metaData->propertyData() + id)->propertyType) {
+    case QMetaType::Int:
+        *reinterpret_cast<int *>(value) = data[id].asInt();
+        break;
+    case QMetaType::Double:
+        *reinterpret_cast<double *>(value) = data[id].asDouble();
+        break;
+    case QMetaType::Bool:
+        *reinterpret_cast<bool *>(value) = data[id].asBool();
+        break;
+    case QMetaType::QString:
+        *reinterpret_cast<QString *>(value) = data[id].asQString();
+        break;
+    case QMetaType::QObjectStar:
+        *reinterpret_cast<QObject **>(value) = data[id].asQObject();
+        break;
+    default:
+        Q_ASSERT(!"QQmlVMEMetaObject::readTypedProperty: property has no typed storage");
+        break;
+    }
+}
+
+/*
+Writes the QML-declared property \a coreIndex, taking the same arguments as a
+QMetaObject::WriteProperty call.  Writes that have to go through a value interceptor
+are passed on to metaCall().
+*/
+void QQmlVMEMetaObject::writeTypedProperty(int coreIndex, void **a)
+{
+    // Interceptors are registered with the outermost VMEMO, see StoreValueInterceptor
+    QQmlVMEMetaObject *outer = QQmlVMEMetaObject::get(object);
+    if (outer->interceptors && !(*reinterpret_cast<int*>(a[3]) & QQmlPropertyPrivate::BypassInterceptor)) {
+        for (QQmlPropertyValueInterceptor *vi = outer->interceptors; vi; vi = vi->m_next) {
+            if (vi->m_coreIndex == coreIndex) {
+                QMetaObject::metacall(object, QMetaObject::WriteProperty, coreIndex, a);
+                return;
+            }
+        }
+    }
+
+    int id = coreIndex - propOffset();
+    Q_ASSERT(id >= 0 && id < firstVarPropertyIndex);
+
+    bool needActivate = false;
+    switch ((metaData->propertyData() + id)->propertyType) {
+    case QMetaType::Int:
+        needActivate = *reinterpret_cast<int *>(a[0]) != data[id].asInt();
+        data[id].setValue(*reinterpret_cast<int *>(a[0]));
+        break;
+    case QMetaType::Double:
+        needActivate = *reinterpret_cast<double *>(a[0]) != data[id].asDouble();
+        data[id].setValue(*reinterpret_cast<double *>(a[0]));
+        break;
+    case QMetaType::Bool:
+        needActivate = *reinterpret_cast<bool *>(a[0]) != data[id].asBool();
+        data[id].setValue(*reinterpret_cast<bool *>(a[0]));
+        break;
+    case QMetaType::QString:
+        needActivate = *reinterpret_cast<QString *>(a[0]) != data[id].asQString();
+        data[id].setValue(*reinterpret_cast<QString *>(a[0]));
+        break;
+    case QMetaType::QObjectStar:
+        needActivate = *reinterpret_cast<QObject **>(a[0]) != data[id].asQObject();
+        data[id].setValue(*reinterpret_cast<QObject **>(a[0]), this, id);
+        break;
+    default:
+        Q_ASSERT(!"QQmlVMEMetaObject::writeTypedProperty: property has no typed storage");
+        break;
+    }
+
+    if (needActivate)
+        activate(object, methodOffset() + id, 0);
+}
+
 QV4::ReturnedValue QQmlVMEMetaObject::vmeProperty(int index)
 {
     if (index < propOffset()) {
@@ -84,8 +84,15 @@ struct QQmlVMEMetaData
     short aliasCount;
     short signalCount;
     short methodCount;
-    short dummyForAlignment; // Add padding to ensure that the following
-                             // AliasData/PropertyData/MethodData is int aligned.
+    short flags; // Also pads the header to ensure that the following
+                 // AliasData/PropertyData/MethodData is int aligned.
+
+    enum Flag {
+        NeedsJSWrapper    = 0x01,
+        HasListProperties = 0x02
+    };
+
+    void updateFlags();
 
     struct AliasData {
         int contextIdx;
@@ -170,6 +177,10 @@ public:
     QV4::ReturnedValue vmeProperty(int index);
     void setVMEProperty(int index, const QV4::ValueRef v);
 
+    static inline bool hasTypedStorage(int vmePropertyType);
+    void readTypedProperty(int coreIndex, void *value);
+    void writeTypedProperty(int coreIndex, void **a);
+
     void connectAliasSignal(int index, bool indexInSignalRange);
 
     virtual QAbstractDynamicMetaObject *toDynamicMetaObject(QObject *o);
@@ -264,6 +275,19 @@ QQmlVMEMetaObject *QQmlVMEMetaObject::get(QObject *obj)
     return 0;
 }
 
+/*
+Returns true if properties stored as \a vmePropertyType can be accessed through
+readTypedProperty() and writeTypedProperty() rather than metaCall().
+*/
+bool QQmlVMEMetaObject::hasTypedStorage(int vmePropertyType)
+{
+    return vmePropertyType == QMetaType::Int ||
+           vmePropertyType == QMetaType::Double ||
+           vmePropertyType == QMetaType::Bool ||
+           vmePropertyType == QMetaType::QString ||
+           vmePropertyType == QMetaType::QObjectStar;
+}
+
 int QQmlVMEMetaObject::propOffset() const
 {
     return cache->propertyOffset();
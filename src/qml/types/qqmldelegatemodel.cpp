@@ -55,6 +55,11 @@
 #include <private/qv4value_p.h>
 #include <private/qv4functionobject_p.h>
 
+#include <QtCore/qregexp.h>
+#include <QtCore/qnumeric.h>
+
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 class QQmlDelegateModelItem;
@@ -174,20 +179,39 @@ QQmlDelegateModelParts::QQmlDelegateModelParts(QQmlDelegateModel *parent)
     module due to compatibility reasons.
 */
 
+static QEvent::Type qt_dataChangedEvent()
+{
+    static const int type = QEvent::registerEventType();
+    return QEvent::Type(type);
+}
+
+static QEvent::Type qt_fetchPagesEvent()
+{
+    static const int type = QEvent::registerEventType();
+    return QEvent::Type(type);
+}
+
 QQmlDelegateModelPrivate::QQmlDelegateModelPrivate(QQmlContext *ctxt)
     : m_delegate(0)
     , m_cacheMetaType(0)
     , m_context(ctxt)
     , m_parts(0)
     , m_filterGroup(QStringLiteral("items"))
+    , m_coalescedDataChanges(0)
     , m_count(0)
     , m_groupCount(Compositor::MinimumGroupCount)
     , m_compositorGroup(Compositor::Cache)
+    , m_sortOrder(Qt::AscendingOrder)
     , m_complete(false)
     , m_delegateValidated(false)
     , m_reset(false)
     , m_transaction(false)
     , m_incubatorCleanupScheduled(false)
+    , m_filtered(false)
+    , m_reuseItems(false)
+    , m_batchDataChanges(false)
+    , m_dataChangesScheduled(false)
+    , m_applyingKeyedReset(false)
     , m_cacheItems(0)
     , m_items(0)
     , m_persistedItems(0)
@@ -231,6 +255,16 @@ QQmlDelegateModel::~QQmlDelegateModel()
 {
     Q_D(QQmlDelegateModel);
 
+    foreach (QQmlDelegateModelItem *cacheItem, d->m_reusableItems) {
+        delete cacheItem->object;
+
+        cacheItem->object = 0;
+        cacheItem->contextData->destroy();
+        cacheItem->contextData = 0;
+        cacheItem->scriptRef -= 1;
+        delete cacheItem;
+    }
+
     foreach (QQmlDelegateModelItem *cacheItem, d->m_cache) {
         if (cacheItem->object) {
             delete cacheItem->object;
@@ -310,6 +344,8 @@ void QQmlDelegateModel::componentComplete()
             defaultGroups | Compositor::AppendFlag | Compositor::PrependFlag,
             &inserts);
     d->itemsInserted(inserts);
+    d->resetKeys();
+    d->updateSortAndFilter();
     d->emitChanges();
 
     if (d->m_adaptorModel.canFetchMore())
@@ -343,6 +379,8 @@ void QQmlDelegateModel::setModel(const QVariant &model)
     if (d->m_complete)
         _q_itemsRemoved(0, d->m_count);
 
+    d->drainReusableItems();
+
     d->m_adaptorModel.setModel(model, this, d->m_context->engine());
     d->m_adaptorModel.replaceWatchedRoles(QList<QByteArray>(), d->m_watchedRoles);
     for (int i = 0; d->m_parts && i < d->m_parts->models.count(); ++i) {
@@ -380,6 +418,7 @@ void QQmlDelegateModel::setDelegate(QQmlComponent *delegate)
     bool wasValid = d->m_delegate != 0;
     d->m_delegate = delegate;
     d->m_delegateValidated = false;
+    d->drainReusableItems();
     if (wasValid && d->m_complete) {
         for (int i = 1; i < d->m_groupCount; ++i) {
             QQmlDelegateModelGroupPrivate::get(d->m_groups[i])->changeSet.remove(
@@ -438,6 +477,7 @@ void QQmlDelegateModel::setRootIndex(const QVariant &root)
     const bool changed = d->m_adaptorModel.rootIndex != modelIndex;
     if (changed || !d->m_adaptorModel.isValid()) {
         const int oldCount = d->m_count;
+        d->m_adaptorModel.releasePages();
         d->m_adaptorModel.rootIndex = modelIndex;
         if (!d->m_adaptorModel.isValid() && d->m_adaptorModel.aim())  // The previous root index was invalidated, so we need to reconnect the model.
             d->m_adaptorModel.setModel(d->m_adaptorModel.list.list(), this, d->m_context->engine());
@@ -491,6 +531,820 @@ QVariant QQmlDelegateModel::parentModelIndex() const
     return d->m_adaptorModel.parentModelIndex();
 }
 
+/*!
+    \qmlproperty string QtQml.Models::DelegateModel::sortRole
+    \since 5.3
+
+    This property holds the name of the model role the \l items group is sorted by.
+
+    When set the items are ordered by the value of the role, compared as numbers, dates or
+    strings, and kept in that order as the model changes.  Values of different kinds are
+    ordered by kind: undefined values first, then numbers, dates and strings.  The values are
+    read directly from the model and the reordering is reported to views as one set of moves,
+    so no JavaScript is evaluated per item.  Items with equal values keep their relative order.
+
+    By default this is empty and the items are in the order of the model.
+
+    \sa sortOrder
+*/
+QString QQmlDelegateModel::sortRole() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortRole;
+}
+
+void QQmlDelegateModel::setSortRole(const QString &role)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortRole == role)
+        return;
+    d->m_sortRole = role;
+    if (d->m_complete) {
+        d->updateSortAndFilter();
+        d->emitChanges();
+    }
+    emit sortRoleChanged();
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::DelegateModel::sortOrder
+    \since 5.3
+
+    This property holds the order the \l items group is sorted in when a \l sortRole is set.
+
+    \list
+    \li Qt.AscendingOrder (default)
+    \li Qt.DescendingOrder
+    \endlist
+*/
+Qt::SortOrder QQmlDelegateModel::sortOrder() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortOrder;
+}
+
+void QQmlDelegateModel::setSortOrder(Qt::SortOrder order)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortOrder == order)
+        return;
+    d->m_sortOrder = order;
+    if (d->m_complete && !d->m_sortRole.isEmpty()) {
+        d->updateSortAndFilter();
+        d->emitChanges();
+    }
+    emit sortOrderChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::DelegateModel::filterRole
+    \since 5.3
+
+    This property holds the name of the model role used to filter the \l items group.
+
+    When set only the model items whose value for the role matches \l filterExpression are
+    members of the \l items group.  The filter takes over the membership of that group, so it
+    should not be combined with changing the group membership of items from JavaScript.
+    Clearing the filter returns every model item to the group.
+
+    \sa filterExpression
+*/
+QString QQmlDelegateModel::filterRole() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_filterRole;
+}
+
+void QQmlDelegateModel::setFilterRole(const QString &role)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_filterRole == role)
+        return;
+    d->m_filterRole = role;
+    if (d->m_complete) {
+        d->updateSortAndFilter();
+        d->emitChanges();
+    }
+    emit filterRoleChanged();
+}
+
+/*!
+    \qmlproperty var QtQml.Models::DelegateModel::filterExpression
+    \since 5.3
+
+    This property holds the value items are matched against when a \l filterRole is set.
+
+    If it is a regular expression an item matches if the expression matches the string value
+    of its role, otherwise an item matches if its value is equal to the expression.  An
+    undefined expression matches every item.
+
+    \qml
+    DelegateModel {
+        model: contacts
+        filterRole: "name"
+        filterExpression: /^A/
+        sortRole: "name"
+    }
+    \endqml
+*/
+QVariant QQmlDelegateModel::filterExpression() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_filterExpression;
+}
+
+void QQmlDelegateModel::setFilterExpression(const QVariant &expression)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_filterExpression == expression)
+        return;
+    d->m_filterExpression = expression;
+    if (d->m_complete && !d->m_filterRole.isEmpty()) {
+        d->updateSortAndFilter();
+        d->emitChanges();
+    }
+    emit filterExpressionChanged();
+}
+
+/*!
+    \qmlproperty bool QtQml.Models::DelegateModel::reuseItems
+    \since 5.3
+
+    This property holds whether delegate instances released by a view are kept for reuse.
+
+    Normally a delegate instance is destroyed when a view no longer needs it, for example when
+    it is scrolled out of the view, and a new instance is created when another item is scrolled
+    in.  If this property is true a released instance is instead kept in a pool, and the next
+    item requested is bound to it rather than being created from the delegate.  This avoids the
+    cost of creating delegates while flicking through long lists.
+
+    A pooled instance stays a child of the view but is hidden, its bindings and any running
+    timers or animations stay active.  A reused instance keeps any state it does not get from
+    the model, so delegates should bind all their per item state to the model data or
+    \c index.  The \c DelegateModel.pooled and \c DelegateModel.reused attached signals are
+    emitted when an instance is put in the pool and when it is taken out again and can be used
+    to pause and reset such state.
+
+    \qml
+    delegate: Item {
+        property bool expanded: false
+        NumberAnimation on opacity { id: fadeIn; from: 0; to: 1 }
+        DelegateModel.onPooled: fadeIn.stop()
+        DelegateModel.onReused: { expanded = false; fadeIn.restart() }
+    }
+    \endqml
+
+    Instances whose model data is referenced from JavaScript, instances of a Package and
+    instances created for a list of QObjects are never reused.
+
+    By default this is false.
+*/
+bool QQmlDelegateModel::reuseItems() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_reuseItems;
+}
+
+void QQmlDelegateModel::setReuseItems(bool reuse)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_reuseItems == reuse)
+        return;
+    d->m_reuseItems = reuse;
+    if (!reuse)
+        d->drainReusableItems();
+    emit reuseItemsChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::DelegateModel::keyRole
+    \since 5.3
+
+    This property holds the name of a model role which uniquely identifies each model item.
+
+    When a model is reset, or a QAbstractItemModel reports its layout has changed, the view
+    normally has to discard every delegate and create new ones as there is no way to tell which
+    of the old items are still in the model and where they are.  If a key role is set the keys
+    of the items before and after the reset are compared, and the reset is reported to views as
+    the removal of the items whose keys are gone, the minimal moves of the items which remain,
+    and the insertion of the new items.  Delegates of items which remain are kept, along with
+    their state.
+
+    If the keys are not unique, or more than 100 of the items which remain would have to be
+    moved, the reset is handled as if no key role were set.
+
+    \code
+    DelegateModel {
+        model: contactModel
+        keyRole: "contactId"
+    }
+    \endcode
+*/
+QString QQmlDelegateModel::keyRole() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_keyRole;
+}
+
+void QQmlDelegateModel::setKeyRole(const QString &role)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_keyRole == role)
+        return;
+    d->m_keyRole = role;
+    if (d->m_complete)
+        d->resetKeys();
+    emit keyRoleChanged();
+}
+
+/*!
+    \qmlproperty bool QtQml.Models::DelegateModel::batchDataChanges
+    \since 5.3
+
+    This property holds whether data changes reported by the model are applied to delegates
+    in batches.
+
+    Normally every change notification from the model is immediately applied to the delegates
+    of the changed items.  A model which changes many items many times a second, such as a
+    list of prices, can then spend most of its time re-evaluating bindings for values that
+    are replaced again before the next frame.  If this property is true the notifications
+    received before control returns to the event loop are merged per set of changed roles,
+    and applied together.  Each role of a delegate is then updated once per batch, and only
+    delegates which currently exist are notified.
+
+    Delegates see data changes slightly later while this is set, code which needs them to
+    be up to date immediately after changing the model should not enable it.
+
+    By default this is false.
+*/
+bool QQmlDelegateModel::batchDataChanges() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_batchDataChanges;
+}
+
+void QQmlDelegateModel::setBatchDataChanges(bool batch)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_batchDataChanges == batch)
+        return;
+    d->m_batchDataChanges = batch;
+    if (!batch)
+        d->flushDataChanges();
+    emit batchDataChangesChanged();
+}
+
+/*!
+    \qmlmethod int QtQml.Models::DelegateModel::coalescedDataChanges()
+    \since 5.3
+
+    Returns the number of data change notifications that were merged into an already
+    pending batch while \l batchDataChanges was set.  Comparing it to the number of
+    changes made to the model shows how much work batching saved.
+
+    \sa batchDataChanges
+*/
+int QQmlDelegateModel::coalescedDataChanges() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_coalescedDataChanges;
+}
+
+/*!
+    \qmlproperty int QtQml.Models::DelegateModel::pageSize
+    \since 5.3
+
+    This property holds the number of rows fetched at a time from a model which loads its
+    rows on demand.
+
+    A QAbstractItemModel with too many rows to load up front, for example one backed by a
+    large database table, can report its full row count and load rows as they are needed.
+    To do this it implements these invokable methods:
+
+    \code
+    Q_INVOKABLE void fetchRows(const QModelIndex &parent, int row, int count);
+    Q_INVOKABLE void releaseRows(const QModelIndex &parent, int row, int count);
+    \endcode
+
+    When a view requests an item from a page of rows which hasn't been fetched, fetchRows() is
+    called for that page after control returns to the event loop.  Requests for items in the
+    same event loop iteration are combined, and as views only request the items within their
+    visible area and cacheBuffer, rows are fetched for the part of the model being viewed.
+    The model may load the rows asynchronously, returning placeholder data for them until
+    they are available and then emitting dataChanged() so delegates are updated.
+
+    The most recently used \l pageCacheSize pages are remembered.  When a page falls out of
+    that cache releaseRows() is called, if the model implements it, so the model can free the
+    rows.  Inserting, removing or moving rows or resetting the model releases the rows of all
+    fetched pages, and the pages of the rows of existing delegates are then fetched again.
+
+    By default this is 0 and rows are not fetched in pages.
+*/
+int QQmlDelegateModel::pageSize() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_adaptorModel.pageSize;
+}
+
+void QQmlDelegateModel::setPageSize(int size)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_adaptorModel.pageSize == size)
+        return;
+    d->m_adaptorModel.releasePages();
+    d->m_adaptorModel.pageSize = size;
+    d->requestCachedPages();
+    emit pageSizeChanged();
+}
+
+/*!
+    \qmlproperty int QtQml.Models::DelegateModel::pageCacheSize
+    \since 5.3
+
+    This property holds the number of fetched pages remembered when \l pageSize is set.
+
+    The default is 16.
+*/
+int QQmlDelegateModel::pageCacheSize() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_adaptorModel.pageCacheSize;
+}
+
+void QQmlDelegateModel::setPageCacheSize(int size)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_adaptorModel.pageCacheSize == size)
+        return;
+    d->m_adaptorModel.pageCacheSize = size;
+    emit pageCacheSizeChanged();
+}
+
+static bool qt_isNumeric(const QVariant &value)
+{
+    switch (value.userType()) {
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Double:
+    case QMetaType::Float:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*
+    Values of different kinds are ordered by kind first, so that mixing numbers, dates and
+    strings in one role still gives a strict weak ordering.  NaN sorts before other numbers.
+*/
+enum SortCategory { InvalidSortCategory, NumberSortCategory, DateTimeSortCategory, DateSortCategory, StringSortCategory };
+
+static SortCategory qt_sortCategory(const QVariant &value)
+{
+    if (!value.isValid())
+        return InvalidSortCategory;
+    if (qt_isNumeric(value))
+        return NumberSortCategory;
+    if (value.userType() == QMetaType::QDateTime)
+        return DateTimeSortCategory;
+    if (value.userType() == QMetaType::QDate)
+        return DateSortCategory;
+    return StringSortCategory;
+}
+
+static bool qt_sortLessThan(const QVariant &left, const QVariant &right)
+{
+    const SortCategory leftCategory = qt_sortCategory(left);
+    const SortCategory rightCategory = qt_sortCategory(right);
+    if (leftCategory != rightCategory)
+        return leftCategory < rightCategory;
+
+    switch (leftCategory) {
+    case InvalidSortCategory:
+        return false;
+    case NumberSortCategory: {
+        const double leftNumber = left.toDouble();
+        const double rightNumber = right.toDouble();
+        if (qIsNaN(leftNumber) || qIsNaN(rightNumber))
+            return qIsNaN(leftNumber) && !qIsNaN(rightNumber);
+        return leftNumber < rightNumber;
+    }
+    case DateTimeSortCategory:
+        return left.toDateTime() < right.toDateTime();
+    case DateSortCategory:
+        return left.toDate() < right.toDate();
+    case StringSortCategory:
+        break;
+    }
+    return left.toString().localeAwareCompare(right.toString()) < 0;
+}
+
+static bool qt_filterAccepts(const QVariant &value, const QVariant &expression)
+{
+    if (!expression.isValid())
+        return true;
+#ifndef QT_NO_REGEXP
+    if (expression.userType() == QMetaType::QRegExp)
+        return expression.toRegExp().indexIn(value.toString()) != -1;
+#endif
+    if (qt_isNumeric(value) && qt_isNumeric(expression))
+        return value.toDouble() == expression.toDouble();
+    return value == expression;
+}
+
+class QQmlDelegateModelSortLessThan
+{
+public:
+    QQmlDelegateModelSortLessThan(const QVector<QVariant> &keys, Qt::SortOrder order)
+        : keys(keys), order(order) {}
+
+    bool operator()(int left, int right) const
+    {
+        return order == Qt::AscendingOrder
+                ? qt_sortLessThan(keys.at(left), keys.at(right))
+                : qt_sortLessThan(keys.at(right), keys.at(left));
+    }
+
+private:
+    const QVector<QVariant> &keys;
+    const Qt::SortOrder order;
+};
+
+/*
+    Returns which items keep their place when a list is rearranged into \a order, where
+    order[i] is the current index of the item which should end up at index i.  The bits are
+    indexed by the current index of the items.
+
+    The items which keep their place are a longest increasing subsequence of the order, so
+    every other item has to be moved exactly once.
+*/
+static QBitArray qt_stayingItems(const QVector<int> &order)
+{
+    const int count = order.count();
+    QVector<int> tails;
+    QVector<int> previous(count, -1);
+    for (int i = 0; i < count; ++i) {
+        int low = 0;
+        int high = tails.count();
+        while (low < high) {
+            const int middle = (low + high) / 2;
+            if (order.at(tails.at(middle)) < order.at(i))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        if (low > 0)
+            previous[i] = tails.at(low - 1);
+        if (low == tails.count())
+            tails.append(i);
+        else
+            tails[low] = i;
+    }
+
+    QBitArray staying(count);
+    for (int i = tails.isEmpty() ? -1 : tails.last(); i >= 0; i = previous.at(i))
+        staying.setBit(order.at(i));
+    return staying;
+}
+
+static inline void qt_addCount(QVector<int> &tree, int index, int count)
+{
+    for (int i = index + 1; i < tree.count(); i += i & -i)
+        tree[i] += count;
+}
+
+static inline int qt_countBefore(const QVector<int> &tree, int index)
+{
+    int count = 0;
+    for (int i = index; i > 0; i -= i & -i)
+        count += tree.at(i);
+    return count;
+}
+
+/*
+    Rearranges a list into \a order, where order[i] is the current index of the item which
+    should end up at index i, by calling mover(from, to, count) for each move.  The items
+    marked in \a staying don't move, every other item is moved once.
+
+    The moved items are placed back to front, each directly in front of the item which follows
+    it in the new order.  That item is either a staying item or a moved one which is in turn
+    directly in front of the next staying item, so the current position of any item can be
+    counted from the staying items in front of it, the items still to be moved which were
+    originally in front of it and the items moved in front of a staying item which was
+    originally in front of it.  Binary indexed trees over the original positions keep the last
+    two counts.  Runs of items which were adjacent originally are moved together.
+*/
+template <typename Mover>
+static void qt_reorder(const QVector<int> &order, const QBitArray &staying, Mover &mover)
+{
+    const int count = order.count();
+    QVector<int> stayingBefore(count + 1, 0);
+    for (int i = 0; i < count; ++i)
+        stayingBefore[i + 1] = stayingBefore.at(i) + (staying.testBit(i) ? 1 : 0);
+
+    QVector<int> unmoved(count + 1, 0);
+    QVector<int> moved(count + 1, 0);
+    for (int i = 0; i < count; ++i) {
+        if (!staying.testBit(i))
+            qt_addCount(unmoved, i, 1);
+    }
+
+    int next = count;
+    for (int to = count - 1; to >= 0;) {
+        const int last = order.at(to);
+        if (staying.testBit(last)) {
+            next = last;
+            --to;
+            continue;
+        }
+
+        int length = 1;
+        for (; length <= to; ++length) {
+            const int index = order.at(to - length);
+            if (staying.testBit(index) || index != last - length)
+                break;
+        }
+        const int first = last - length + 1;
+
+        const int from = stayingBefore.at(first)
+                + qt_countBefore(moved, first)
+                + qt_countBefore(unmoved, first);
+        for (int i = first; i <= last; ++i)
+            qt_addCount(unmoved, i, -1);
+        const int position = stayingBefore.at(next) + qt_countBefore(unmoved, next);
+
+        if (from != position)
+            mover(from, position, length);
+        if (next < count)
+            qt_addCount(moved, next, length);
+        to -= length;
+    }
+}
+
+static const int qt_maximumMoves = 100;
+
+class QQmlDelegateModelGroupMover
+{
+public:
+    QQmlDelegateModelGroupMover(QQmlDelegateModelPrivate *model, bool reset)
+        : model(model), reset(reset) {}
+
+    void operator()(int from, int to, int count)
+    {
+        QVector<QQmlListCompositor::Remove> removes;
+        QVector<QQmlListCompositor::Insert> inserts;
+        model->m_compositor.move(
+                QQmlListCompositor::Default, from, QQmlListCompositor::Default, to, count,
+                QQmlListCompositor::Default, &removes, &inserts);
+        if (!reset) {
+            model->itemsMoved(removes, inserts);
+            return;
+        }
+
+        // The groups are reset once all the items are in place, so only the cached items are
+        // moved here.
+        QHash<int, QList<QQmlDelegateModelItem *> > movedItems;
+        QVarLengthArray<QVector<QQmlChangeSet::Remove>, QQmlListCompositor::MaximumGroupCount> translatedRemoves(model->m_groupCount);
+        model->itemsRemoved(removes, &translatedRemoves, &movedItems);
+        QVarLengthArray<QVector<QQmlChangeSet::Insert>, QQmlListCompositor::MaximumGroupCount> translatedInserts(model->m_groupCount);
+        model->itemsInserted(inserts, &translatedInserts, &movedItems);
+        Q_ASSERT(movedItems.isEmpty());
+    }
+
+private:
+    QQmlDelegateModelPrivate * const model;
+    const bool reset;
+};
+
+class QQmlDelegateModelListMover
+{
+public:
+    QQmlDelegateModelListMover(QQmlDelegateModelPrivate *model) : model(model) {}
+
+    void operator()(int from, int to, int count) { model->moveListItems(from, to, count); }
+
+private:
+    QQmlDelegateModelPrivate * const model;
+};
+
+/*
+    Applies the filter and sort order to the items group.  Returns false if neither is set.
+
+    The changes are accumulated in the change sets of the groups, the caller is responsible for
+    emitting them.
+*/
+bool QQmlDelegateModelPrivate::updateSortAndFilter()
+{
+    if (!m_filterRole.isEmpty() || m_filtered)
+        filterItems();
+    if (!m_sortRole.isEmpty())
+        sortItems();
+    return !m_filterRole.isEmpty() || !m_sortRole.isEmpty();
+}
+
+/*
+    Returns true if a change to the data of \a roles may change the filtering or sort order of
+    the items.  An empty list of roles means all roles have changed.
+*/
+bool QQmlDelegateModelPrivate::sortAndFilterDependOn(const QVector<int> &roles) const
+{
+    if (m_filterRole.isEmpty() && m_sortRole.isEmpty())
+        return m_filtered;
+    if (roles.isEmpty())
+        return true;
+
+    const QHash<int, QByteArray> roleNames = m_adaptorModel.aim()->roleNames();
+    foreach (int role, roles) {
+        const QString name = QString::fromUtf8(roleNames.value(role));
+        if (name.isEmpty() || name == m_filterRole || name == m_sortRole)
+            return true;
+    }
+    return false;
+}
+
+void QQmlDelegateModelPrivate::filterItems()
+{
+    QBitArray accepted(m_count, true);
+    if (!m_filterRole.isEmpty()) {
+        for (int i = 0; i < m_count; ++i)
+            accepted.setBit(i, qt_filterAccepts(m_adaptorModel.value(i, m_filterRole), m_filterExpression));
+    }
+    m_filtered = !m_filterRole.isEmpty();
+
+    // Update the membership of all items in two passes over the compositor, rather than one
+    // setFlags() or clearFlags() per item.
+    QVector<Compositor::Insert> inserts;
+    m_compositor.setListFlags(&m_adaptorModel, accepted, Compositor::DefaultFlag, &inserts);
+    itemsInserted(inserts);
+
+    QVector<Compositor::Remove> removes;
+    m_compositor.clearListFlags(&m_adaptorModel, ~accepted, Compositor::DefaultFlag, &removes);
+    itemsRemoved(removes);
+}
+
+void QQmlDelegateModelPrivate::sortItems()
+{
+    const int count = m_compositor.count(Compositor::Default);
+    if (count < 2)
+        return;
+
+    QVector<QVariant> keys(count);
+    Compositor::iterator it = m_compositor.find(Compositor::Default, 0);
+    for (int i = 0; i < count; ++i, it += 1) {
+        if (QQmlAdaptorModel *model = it.list<QQmlAdaptorModel>())
+            keys[i] = model->value(it.modelIndex(), m_sortRole);
+    }
+
+    QVector<int> order(count);
+    for (int i = 0; i < count; ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), QQmlDelegateModelSortLessThan(keys, m_sortOrder));
+
+    const QBitArray staying = qt_stayingItems(order);
+    const int moves = count - staying.count(true);
+    if (moves == 0)
+        return;
+
+    // Each move is merged into the change sets of the groups, which gets slower the more moves
+    // there are, and views animate each one.  Past a point it's cheaper for everyone to reset
+    // the groups instead.
+    const bool reset = moves > qt_maximumMoves;
+    QQmlDelegateModelGroupMover mover(this, reset);
+    qt_reorder(order, staying, mover);
+
+    if (reset && m_delegate) {
+        for (int i = 1; i < m_groupCount; ++i) {
+            QQmlChangeSet &changeSet = QQmlDelegateModelGroupPrivate::get(m_groups[i])->changeSet;
+            const int groupCount = m_compositor.count(Compositor::Group(i));
+            changeSet.remove(0, groupCount);
+            changeSet.insert(0, groupCount);
+        }
+    }
+}
+
+QString QQmlDelegateModelPrivate::keyValue(int index) const
+{
+    return m_adaptorModel.value(index, m_keyRole).toString();
+}
+
+/*
+    Takes a snapshot of the keys of all model items, the snapshot is kept up to date as the
+    model changes so that it still holds the old keys when the model is reset.
+*/
+void QQmlDelegateModelPrivate::resetKeys()
+{
+    m_keys.clear();
+    if (!m_keyRole.isEmpty()) {
+        m_keys.resize(m_count);
+        for (int i = 0; i < m_count; ++i)
+            m_keys[i] = keyValue(i);
+    }
+}
+
+static bool qt_indexKeys(const QVector<QString> &keys, QHash<QString, int> *indexes)
+{
+    indexes->reserve(keys.count());
+    for (int i = 0; i < keys.count(); ++i) {
+        if (keys.at(i).isEmpty())
+            return false;
+        indexes->insert(keys.at(i), i);
+    }
+    return indexes->count() == keys.count();
+}
+
+/*
+    Updates the model items after a model reset by comparing the keys of the items before and
+    after the reset.  Items which are no longer in the model are removed first, then the ones
+    which remain are moved into their new order, and finally the new items are inserted.
+
+    Returns false if there is no key role, the keys don't identify the items or too many items
+    would have to be moved, in which case nothing is changed.
+*/
+bool QQmlDelegateModelPrivate::applyKeyedReset()
+{
+    if (m_keyRole.isEmpty() || m_keys.count() != m_count)
+        return false;
+
+    const int newCount = m_adaptorModel.count();
+    QVector<QString> newKeys(newCount);
+    for (int i = 0; i < newCount; ++i)
+        newKeys[i] = keyValue(i);
+
+    QHash<QString, int> oldIndexes;
+    QHash<QString, int> newIndexes;
+    if (!qt_indexKeys(m_keys, &oldIndexes) || !qt_indexKeys(newKeys, &newIndexes))
+        return false;
+
+    // Order the remaining items by their new index, using their index once the items which
+    // are gone have been removed.
+    QVector<int> remainingIndexes(m_keys.count(), -1);
+    int remainingCount = 0;
+    for (int i = 0; i < m_keys.count(); ++i) {
+        if (newIndexes.contains(m_keys.at(i)))
+            remainingIndexes[i] = remainingCount++;
+    }
+    QVector<int> order;
+    order.reserve(remainingCount);
+    for (int i = 0; i < newCount; ++i) {
+        QHash<QString, int>::const_iterator it = oldIndexes.constFind(newKeys.at(i));
+        if (it != oldIndexes.constEnd())
+            order.append(remainingIndexes.at(*it));
+    }
+
+    // Past a point moving the items one by one costs more than recreating them.
+    const QBitArray staying = qt_stayingItems(order);
+    if (remainingCount - staying.count(true) > qt_maximumMoves)
+        return false;
+
+    // The keys of the new model are known, so they don't have to be kept up to date item by
+    // item.
+    m_keys.clear();
+    m_applyingKeyedReset = true;
+
+    // Remove the items which are gone back to front so the indexes of the remaining removals
+    // aren't affected.
+    for (int i = remainingIndexes.count() - 1; i >= 0;) {
+        int count = 0;
+        for (; i - count >= 0 && remainingIndexes.at(i - count) == -1; ++count) {}
+        if (count > 0) {
+            removeListItems(i - count + 1, count);
+            i -= count;
+        } else {
+            --i;
+        }
+    }
+
+    QQmlDelegateModelListMover mover(this);
+    qt_reorder(order, staying, mover);
+
+    // The remaining items are now in the same order as in the new model, so inserting the new
+    // items front to back puts everything at its new index.
+    for (int i = 0; i < newCount;) {
+        int count = 0;
+        for (; i + count < newCount && !oldIndexes.contains(newKeys.at(i + count)); ++count) {}
+        if (count > 0) {
+            insertListItems(i, count);
+            i += count;
+        } else {
+            ++i;
+        }
+    }
+    Q_ASSERT(m_count == newCount);
+    m_applyingKeyedReset = false;
+    requestCachedPages();
+
+    // The data of the items which remain may have changed as well.
+    if (m_count > 0 && m_adaptorModel.notify(m_cache, 0, m_count, QVector<int>())) {
+        QVector<Compositor::Change> changes;
+        m_compositor.listItemsChanged(&m_adaptorModel, 0, m_count, &changes);
+        itemsChanged(changes);
+    }
+    m_keys = newKeys;
+    return true;
+}
+
 /*!
     \qmlproperty int QtQml.Models::DelegateModel::count
 */
@@ -511,6 +1365,9 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
 
     if (QQmlDelegateModelItem *cacheItem = QQmlDelegateModelItem::dataForObject(object)) {
         if (cacheItem->releaseObject()) {
+            if (m_reuseItems && cacheItem->object == object && poolItem(cacheItem))
+                return QQmlInstanceModel::Pooled;
+
             cacheItem->destroyObject();
             emitDestroyingItem(object);
             if (cacheItem->incubationTask) {
@@ -526,6 +1383,79 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
     return stat;
 }
 
+static const int qt_maximumReusableItems = 64;
+
+/*
+    Moves a delegate instance which no longer has any references to the pool of reusable items.
+
+    The model data item stays with its delegate instance and is rebound to a new index when it
+    is reused, so items which might be observed from elsewhere are never pooled.
+*/
+bool QQmlDelegateModelPrivate::poolItem(QQmlDelegateModelItem *cacheItem)
+{
+    if (cacheItem->scriptRef != 1
+            || cacheItem->incubationTask
+            || (cacheItem->groups & Compositor::UnresolvedFlag)
+            || m_adaptorModel.hasProxyObject()
+            || qmlobject_cast<QQuickPackage *>(cacheItem->object)
+            || m_reusableItems.count() >= qt_maximumReusableItems) {
+        return false;
+    }
+
+    removeCacheItem(cacheItem);
+    cacheItem->groups = 0;
+    m_reusableItems.append(cacheItem);
+
+    if (QQmlDelegateModelAttached *attached = cacheItem->attached) {
+        for (int i = 1; i < m_groupCount; ++i)
+            attached->m_currentIndex[i] = -1;
+        attached->emitChanges();
+        attached->emitPooled();
+    }
+    return true;
+}
+
+/*
+    Binds a pooled delegate instance to the item at \a it and adds it to the cache.
+*/
+QQmlDelegateModelItem *QQmlDelegateModelPrivate::reuseItem(Compositor::iterator it)
+{
+    QQmlDelegateModelItem *cacheItem = m_reusableItems.takeLast();
+
+    cacheItem->index = -1;
+    if (!cacheItem->resolveIndex(m_adaptorModel, it.modelIndex())) {
+        QObject *object = cacheItem->object;
+        cacheItem->destroyObject();
+        emitDestroyingItem(object);
+        cacheItem->Dispose();
+        return 0;
+    }
+    cacheItem->groups = it->flags;
+
+    m_cache.insert(it.cacheIndex, cacheItem);
+    m_compositor.setFlags(it, 1, Compositor::CacheFlag);
+    Q_ASSERT(m_cache.count() == m_compositor.count(Compositor::Cache));
+
+    if (QQmlDelegateModelAttached *attached = cacheItem->attached) {
+        for (int i = 1; i < m_groupCount; ++i)
+            attached->m_currentIndex[i] = it.index[i];
+        attached->emitChanges();
+        attached->emitReused();
+    }
+    return cacheItem;
+}
+
+void QQmlDelegateModelPrivate::drainReusableItems()
+{
+    while (!m_reusableItems.isEmpty()) {
+        QQmlDelegateModelItem *cacheItem = m_reusableItems.takeLast();
+        QObject *object = cacheItem->object;
+        cacheItem->destroyObject();
+        emitDestroyingItem(object);
+        cacheItem->Dispose();
+    }
+}
+
 /*
   Returns ReleaseStatus flags.
 */
@@ -911,6 +1841,9 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, bo
 
     QQmlDelegateModelItem *cacheItem = it->inCache() ? m_cache.at(it.cacheIndex) : 0;
 
+    if (!cacheItem && !m_reusableItems.isEmpty())
+        cacheItem = reuseItem(it);
+
     if (!cacheItem) {
         cacheItem = m_adaptorModel.createItem(m_cacheMetaType, m_context->engine(), it.modelIndex());
         if (!cacheItem)
@@ -968,6 +1901,8 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, bo
 
     if (index == m_compositor.count(group) - 1 && m_adaptorModel.canFetchMore())
         QCoreApplication::postEvent(q, new QEvent(QEvent::UpdateRequest));
+    if (it.list<QQmlAdaptorModel>() && m_adaptorModel.requestPage(it.modelIndex()))
+        QCoreApplication::postEvent(q, new QEvent(qt_fetchPagesEvent()));
 
     // Remove the temporary reference count.
     cacheItem->scriptRef -= 1;
@@ -1092,6 +2027,11 @@ bool QQmlDelegateModel::event(QEvent *e)
         d->m_incubatorCleanupScheduled = false;
         qDeleteAll(d->m_finishedIncubating);
         d->m_finishedIncubating.clear();
+    } else if (e->type() == qt_dataChangedEvent()) {
+        d->m_dataChangesScheduled = false;
+        d->flushDataChanges();
+    } else if (e->type() == qt_fetchPagesEvent()) {
+        d->m_adaptorModel.fetchRequestedPages();
     }
     return QQmlInstanceModel::event(e);
 }
@@ -1121,14 +2061,166 @@ void QQmlDelegateModel::_q_itemsChanged(int index, int count, const QVector<int>
     if (count <= 0 || !d->m_complete)
         return;
 
-    if (d->m_adaptorModel.notify(d->m_cache, index, count, roles)) {
-        QVector<Compositor::Change> changes;
-        d->m_compositor.listItemsChanged(&d->m_adaptorModel, index, count, &changes);
-        d->itemsChanged(changes);
+    if (!d->m_keyRole.isEmpty()) {
+        for (int i = index; i < index + count && i < d->m_keys.count(); ++i)
+            d->m_keys[i] = d->keyValue(i);
+    }
+
+    if (d->m_batchDataChanges) {
+        d->queueDataChange(index, count, roles);
+        return;
+    }
+
+    bool changed = d->applyDataChange(index, count, roles);
+    if (d->sortAndFilterDependOn(roles))
+        changed |= d->updateSortAndFilter();
+    if (changed)
         d->emitChanges();
+}
+
+bool QQmlDelegateModelPrivate::applyDataChange(int index, int count, const QVector<int> &roles)
+{
+    if (m_adaptorModel.notify(m_cache, index, count, roles)) {
+        QVector<Compositor::Change> changes;
+        m_compositor.listItemsChanged(&m_adaptorModel, index, count, &changes);
+        itemsChanged(changes);
+        return true;
+    }
+    return false;
+}
+
+
+/*
+    Adds the range \a index, \a count to a sorted list of disjoint \a ranges, merging it with
+    any ranges it overlaps or touches.
+*/
+static void qt_addRange(QVector<QQmlChangeSet::Change> *ranges, int index, int count)
+{
+    int start = index;
+    int end = index + count;
+    int i = 0;
+    while (i < ranges->count() && ranges->at(i).end() < start)
+        ++i;
+    int j = i;
+    for (; j < ranges->count() && ranges->at(j).start() <= end; ++j) {
+        start = qMin(start, ranges->at(j).start());
+        end = qMax(end, ranges->at(j).end());
+    }
+    ranges->remove(i, j - i);
+    ranges->insert(i, QQmlChangeSet::Change(start, end - start));
+}
+
+static void qt_insertRows(QVector<QQmlChangeSet::Change> *ranges, int index, int count)
+{
+    for (int i = 0; i < ranges->count(); ++i) {
+        QQmlChangeSet::Change &range = (*ranges)[i];
+        if (range.index >= index) {
+            range.index += count;
+        } else if (range.end() > index) {
+            // Split the range around the inserted rows.
+            const QQmlChangeSet::Change tail(index + count, range.end() - index);
+            range.count = index - range.index;
+            ranges->insert(++i, tail);
+        }
+    }
+}
+
+static void qt_removeRows(QVector<QQmlChangeSet::Change> *ranges, int index, int count)
+{
+    for (int i = 0; i < ranges->count();) {
+        QQmlChangeSet::Change &range = (*ranges)[i];
+        const int start = range.index < index
+                ? range.index
+                : qMax(index, range.index - count);
+        const int end = range.end() <= index
+                ? range.end()
+                : qMax(index, range.end() - count);
+        if (end > start) {
+            range.index = start;
+            range.count = end - start;
+            ++i;
+        } else {
+            ranges->remove(i);
+        }
+    }
+    // Ranges either side of the removed rows may now touch.
+    for (int i = 1; i < ranges->count();) {
+        if ((*ranges)[i - 1].end() >= ranges->at(i).start()) {
+            (*ranges)[i - 1].count = ranges->at(i).end() - ranges->at(i - 1).index;
+            ranges->remove(i);
+        } else {
+            ++i;
+        }
     }
 }
 
+/*
+    Records a data change to be applied to the delegates together with any other changes
+    received before control returns to the event loop.
+*/
+void QQmlDelegateModelPrivate::queueDataChange(int index, int count, const QVector<int> &roles)
+{
+    Q_Q(QQmlDelegateModel);
+
+    int i = 0;
+    for (; i < m_pendingDataChanges.count(); ++i) {
+        const PendingDataChange &pending = m_pendingDataChanges.at(i);
+        if (pending.roles == roles)
+            break;
+    }
+    if (i == m_pendingDataChanges.count()) {
+        m_pendingDataChanges.append(PendingDataChange());
+        m_pendingDataChanges[i].roles = roles;
+    }
+    qt_addRange(&m_pendingDataChanges[i].ranges, index, count);
+
+    if (m_dataChangesScheduled) {
+        ++m_coalescedDataChanges;
+    } else {
+        m_dataChangesScheduled = true;
+        QCoreApplication::postEvent(q, new QEvent(qt_dataChangedEvent()));
+    }
+}
+
+/*
+    Keeps the indexes of queued data changes in step with rows inserted, removed or moved
+    since they were queued.  Moved rows are marked as changed at their new position.
+*/
+void QQmlDelegateModelPrivate::updatePendingDataChanges(
+        int removeIndex, int removeCount, int insertIndex, int insertCount)
+{
+    for (int i = 0; i < m_pendingDataChanges.count(); ++i) {
+        QVector<QQmlChangeSet::Change> &ranges = m_pendingDataChanges[i].ranges;
+        if (removeCount > 0)
+            qt_removeRows(&ranges, removeIndex, removeCount);
+        if (insertCount > 0)
+            qt_insertRows(&ranges, insertIndex, insertCount);
+        if (removeCount > 0 && insertCount > 0)
+            qt_addRange(&ranges, insertIndex, insertCount);
+    }
+}
+
+void QQmlDelegateModelPrivate::flushDataChanges()
+{
+    if (m_pendingDataChanges.isEmpty())
+        return;
+
+    const QVector<PendingDataChange> pendingChanges = m_pendingDataChanges;
+    m_pendingDataChanges.clear();
+
+    bool changed = false;
+    bool resort = false;
+    foreach (const PendingDataChange &pending, pendingChanges) {
+        foreach (const QQmlChangeSet::Change &range, pending.ranges)
+            changed |= applyDataChange(range.index, range.count, pending.roles);
+        resort |= sortAndFilterDependOn(pending.roles);
+    }
+    if (resort)
+        changed |= updateSortAndFilter();
+    if (changed)
+        emitChanges();
+}
+
 static void incrementIndexes(QQmlDelegateModelItem *cacheItem, int count, const int *deltas)
 {
     if (QQDMIncubationTask *incubationTask = cacheItem->incubationTask) {
@@ -1210,25 +2302,60 @@ void QQmlDelegateModelPrivate::itemsInserted(const QVector<Compositor::Insert> &
         QQmlDelegateModelGroupPrivate::get(m_groups[i])->changeSet.insert(translatedInserts.at(i));
 }
 
-void QQmlDelegateModel::_q_itemsInserted(int index, int count)
+/*
+    Requests the pages of the rows of the cached items, after the pages fetched for them have
+    been released.  Views only request items when they create them, so the delegates which
+    remain would otherwise keep showing rows the model has freed.
+*/
+void QQmlDelegateModelPrivate::requestCachedPages()
 {
-
-    Q_D(QQmlDelegateModel);
-    if (count <= 0 || !d->m_complete)
+    Q_Q(QQmlDelegateModel);
+    if (m_applyingKeyedReset)
         return;
 
-    d->m_count += count;
+    bool requested = false;
+    foreach (QQmlDelegateModelItem *cacheItem, m_cache) {
+        if (cacheItem->modelIndex() >= 0 && m_adaptorModel.requestPage(cacheItem->modelIndex()))
+            requested = true;
+    }
+    if (requested)
+        QCoreApplication::postEvent(q, new QEvent(qt_fetchPagesEvent()));
+}
+
+void QQmlDelegateModelPrivate::insertListItems(int index, int count)
+{
+    m_count += count;
+    m_adaptorModel.releasePages(-1, index, count);
+    updatePendingDataChanges(0, 0, index, count);
 
-    const QList<QQmlDelegateModelItem *> cache = d->m_cache;
+    const QList<QQmlDelegateModelItem *> cache = m_cache;
     for (int i = 0, c = cache.count();  i < c; ++i) {
         QQmlDelegateModelItem *item = cache.at(i);
         if (item->modelIndex() >= index)
             item->setModelIndex(item->modelIndex() + count);
     }
+    requestCachedPages();
+
+    if (!m_keyRole.isEmpty() && !m_applyingKeyedReset) {
+        m_keys.insert(index, count, QString());
+        for (int i = index; i < index + count; ++i)
+            m_keys[i] = keyValue(i);
+    }
 
     QVector<Compositor::Insert> inserts;
-    d->m_compositor.listItemsInserted(&d->m_adaptorModel, index, count, &inserts);
-    d->itemsInserted(inserts);
+    m_compositor.listItemsInserted(&m_adaptorModel, index, count, &inserts);
+    itemsInserted(inserts);
+}
+
+void QQmlDelegateModel::_q_itemsInserted(int index, int count)
+{
+
+    Q_D(QQmlDelegateModel);
+    if (count <= 0 || !d->m_complete)
+        return;
+
+    d->insertListItems(index, count);
+    d->updateSortAndFilter();
     d->emitChanges();
 }
 
@@ -1328,14 +2455,12 @@ void QQmlDelegateModelPrivate::itemsRemoved(const QVector<Compositor::Remove> &r
        QQmlDelegateModelGroupPrivate::get(m_groups[i])->changeSet.remove(translatedRemoves.at(i));
 }
 
-void QQmlDelegateModel::_q_itemsRemoved(int index, int count)
+void QQmlDelegateModelPrivate::removeListItems(int index, int count)
 {
-    Q_D(QQmlDelegateModel);
-    if (count <= 0|| !d->m_complete)
-        return;
-
-    d->m_count -= count;
-    const QList<QQmlDelegateModelItem *> cache = d->m_cache;
+    m_count -= count;
+    m_adaptorModel.releasePages(index, -1, count);
+    updatePendingDataChanges(index, count, 0, 0);
+    const QList<QQmlDelegateModelItem *> cache = m_cache;
     for (int i = 0, c = cache.count();  i < c; ++i) {
         QQmlDelegateModelItem *item = cache.at(i);
         if (item->modelIndex() >= index + count)
@@ -1343,10 +2468,23 @@ void QQmlDelegateModel::_q_itemsRemoved(int index, int count)
         else  if (item->modelIndex() >= index)
             item->setModelIndex(-1);
     }
+    requestCachedPages();
+
+    if (!m_keyRole.isEmpty() && !m_applyingKeyedReset)
+        m_keys.remove(index, count);
 
     QVector<Compositor::Remove> removes;
-    d->m_compositor.listItemsRemoved(&d->m_adaptorModel, index, count, &removes);
-    d->itemsRemoved(removes);
+    m_compositor.listItemsRemoved(&m_adaptorModel, index, count, &removes);
+    itemsRemoved(removes);
+}
+
+void QQmlDelegateModel::_q_itemsRemoved(int index, int count)
+{
+    Q_D(QQmlDelegateModel);
+    if (count <= 0|| !d->m_complete)
+        return;
+
+    d->removeListItems(index, count);
 
     d->emitChanges();
 }
@@ -1373,17 +2511,16 @@ void QQmlDelegateModelPrivate::itemsMoved(
     }
 }
 
-void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
+void QQmlDelegateModelPrivate::moveListItems(int from, int to, int count)
 {
-    Q_D(QQmlDelegateModel);
-    if (count <= 0 || !d->m_complete)
-        return;
+    m_adaptorModel.releasePages(from, to, count);
+    updatePendingDataChanges(from, count, to, count);
 
     const int minimum = qMin(from, to);
     const int maximum = qMax(from, to) + count;
     const int difference = from > to ? count : -count;
 
-    const QList<QQmlDelegateModelItem *> cache = d->m_cache;
+    const QList<QQmlDelegateModelItem *> cache = m_cache;
     for (int i = 0, c = cache.count();  i < c; ++i) {
         QQmlDelegateModelItem *item = cache.at(i);
         if (item->modelIndex() >= from && item->modelIndex() < from + count)
@@ -1391,11 +2528,30 @@ void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
         else if (item->modelIndex() >= minimum && item->modelIndex() < maximum)
             item->setModelIndex(item->modelIndex() + difference);
     }
+    requestCachedPages();
+
+    if (!m_keyRole.isEmpty() && !m_applyingKeyedReset) {
+        const QVector<QString> moved = m_keys.mid(from, count);
+        m_keys.remove(from, count);
+        m_keys.insert(to, count, QString());
+        std::copy(moved.begin(), moved.end(), m_keys.begin() + to);
+    }
 
     QVector<Compositor::Remove> removes;
     QVector<Compositor::Insert> inserts;
-    d->m_compositor.listItemsMoved(&d->m_adaptorModel, from, to, count, &removes, &inserts);
-    d->itemsMoved(removes, inserts);
+    m_compositor.listItemsMoved(&m_adaptorModel, from, to, count, &removes, &inserts);
+    itemsMoved(removes, inserts);
+}
+
+void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
+{
+    Q_D(QQmlDelegateModel);
+    if (count <= 0 || !d->m_complete)
+        return;
+
+    d->moveListItems(from, to, count);
+    if (!d->m_sortRole.isEmpty())
+        d->sortItems();
     d->emitChanges();
 }
 
@@ -1429,6 +2585,13 @@ void QQmlDelegateModelPrivate::emitChanges()
     }
 }
 
+void QQmlDelegateModel::_q_modelAboutToBeReset()
+{
+    Q_D(QQmlDelegateModel);
+    // The rows of the fetched pages can only be released while they are still in the model.
+    d->m_adaptorModel.releasePages();
+}
+
 void QQmlDelegateModel::_q_modelReset()
 {
     Q_D(QQmlDelegateModel);
@@ -1438,7 +2601,17 @@ void QQmlDelegateModel::_q_modelReset()
     int oldCount = d->m_count;
     d->m_adaptorModel.rootIndex = QModelIndex();
 
-    if (d->m_complete) {
+    // The reset notifies all remaining items of changes.
+    d->m_pendingDataChanges.clear();
+    d->m_adaptorModel.resetPages();
+
+    if (d->m_complete && d->applyKeyedReset()) {
+        if (d->m_adaptorModel.canFetchMore())
+            d->m_adaptorModel.fetchMore();
+
+        d->updateSortAndFilter();
+        d->emitChanges();
+    } else if (d->m_complete) {
         d->m_count = d->m_adaptorModel.count();
 
         const QList<QQmlDelegateModelItem *> cache = d->m_cache;
@@ -1456,10 +2629,12 @@ void QQmlDelegateModel::_q_modelReset()
             d->m_compositor.listItemsInserted(&d->m_adaptorModel, 0, d->m_count, &inserts);
         d->itemsMoved(removes, inserts);
         d->m_reset = true;
+        d->resetKeys();
 
         if (d->m_adaptorModel.canFetchMore())
             d->m_adaptorModel.fetchMore();
 
+        d->updateSortAndFilter();
         d->emitChanges();
     }
     emit rootIndexChanged();
@@ -2059,6 +3234,8 @@ void QQmlDelegateModelAttached::setGroups(const QStringList &groups)
 
     const int groupFlags = model->m_cacheMetaType->parseGroups(groups);
     const int cacheIndex = model->m_cache.indexOf(m_cacheItem);
+    if (cacheIndex < 0)
+        return;
     Compositor::iterator it = model->m_compositor.find(Compositor::Cache, cacheIndex);
     model->setGroups(it, 1, Compositor::Cache, groupFlags);
 }
@@ -2083,6 +3260,27 @@ bool QQmlDelegateModelAttached::isUnresolved() const
     return m_cacheItem->groups & Compositor::UnresolvedFlag;
 }
 
+/*!
+    \qmlattachedsignal QtQml.Models::DelegateModel::onPooled()
+    \since 5.3
+
+    This signal is emitted when a view has released the delegate instance and it has been put
+    in the pool of reusable items instead of being destroyed.  While pooled the instance is not
+    a member of any group.
+
+    \sa reuseItems
+*/
+
+/*!
+    \qmlattachedsignal QtQml.Models::DelegateModel::onReused()
+    \since 5.3
+
+    This signal is emitted when a pooled delegate instance has been bound to a new item, after
+    the model data and index have been updated.
+
+    \sa reuseItems
+*/
+
 /*!
     \qmlattachedproperty int QtQml.Models::DelegateModel::inItems
 
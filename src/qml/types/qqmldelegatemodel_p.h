@@ -78,6 +78,15 @@ class Q_QML_PRIVATE_EXPORT QQmlDelegateModel : public QQmlInstanceModel, public
     Q_PROPERTY(QQmlListProperty<QQmlDelegateModelGroup> groups READ groups CONSTANT)
     Q_PROPERTY(QObject *parts READ parts CONSTANT)
     Q_PROPERTY(QVariant rootIndex READ rootIndex WRITE setRootIndex NOTIFY rootIndexChanged)
+    Q_PROPERTY(QString sortRole READ sortRole WRITE setSortRole NOTIFY sortRoleChanged REVISION 1)
+    Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder NOTIFY sortOrderChanged REVISION 1)
+    Q_PROPERTY(QString filterRole READ filterRole WRITE setFilterRole NOTIFY filterRoleChanged REVISION 1)
+    Q_PROPERTY(QVariant filterExpression READ filterExpression WRITE setFilterExpression NOTIFY filterExpressionChanged REVISION 1)
+    Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged REVISION 1)
+    Q_PROPERTY(QString keyRole READ keyRole WRITE setKeyRole NOTIFY keyRoleChanged REVISION 1)
+    Q_PROPERTY(bool batchDataChanges READ batchDataChanges WRITE setBatchDataChanges NOTIFY batchDataChangesChanged REVISION 1)
+    Q_PROPERTY(int pageSize READ pageSize WRITE setPageSize NOTIFY pageSizeChanged REVISION 1)
+    Q_PROPERTY(int pageCacheSize READ pageCacheSize WRITE setPageCacheSize NOTIFY pageCacheSizeChanged REVISION 1)
     Q_CLASSINFO("DefaultProperty", "delegate")
     Q_INTERFACES(QQmlParserStatus)
 public:
@@ -97,6 +106,34 @@ public:
     QVariant rootIndex() const;
     void setRootIndex(const QVariant &root);
 
+    QString sortRole() const;
+    void setSortRole(const QString &role);
+
+    Qt::SortOrder sortOrder() const;
+    void setSortOrder(Qt::SortOrder order);
+
+    QString filterRole() const;
+    void setFilterRole(const QString &role);
+
+    QVariant filterExpression() const;
+    void setFilterExpression(const QVariant &expression);
+
+    bool reuseItems() const;
+    void setReuseItems(bool reuse);
+
+    QString keyRole() const;
+    void setKeyRole(const QString &role);
+
+    bool batchDataChanges() const;
+    void setBatchDataChanges(bool batch);
+    Q_REVISION(1) Q_INVOKABLE int coalescedDataChanges() const;
+
+    int pageSize() const;
+    void setPageSize(int size);
+
+    int pageCacheSize() const;
+    void setPageCacheSize(int size);
+
     Q_INVOKABLE QVariant modelIndex(int idx) const;
     Q_INVOKABLE QVariant parentModelIndex() const;
 
@@ -127,12 +164,22 @@ Q_SIGNALS:
     void filterGroupChanged();
     void defaultGroupsChanged();
     void rootIndexChanged();
+    Q_REVISION(1) void sortRoleChanged();
+    Q_REVISION(1) void sortOrderChanged();
+    Q_REVISION(1) void filterRoleChanged();
+    Q_REVISION(1) void filterExpressionChanged();
+    Q_REVISION(1) void reuseItemsChanged();
+    Q_REVISION(1) void keyRoleChanged();
+    Q_REVISION(1) void batchDataChangesChanged();
+    Q_REVISION(1) void pageSizeChanged();
+    Q_REVISION(1) void pageCacheSizeChanged();
 
 private Q_SLOTS:
     void _q_itemsChanged(int index, int count, const QVector<int> &roles);
     void _q_itemsInserted(int index, int count);
     void _q_itemsRemoved(int index, int count);
     void _q_itemsMoved(int from, int to, int count);
+    void _q_modelAboutToBeReset();
     void _q_modelReset();
     void _q_rowsInserted(const QModelIndex &,int,int);
     void _q_rowsAboutToBeRemoved(const QModelIndex &parent, int begin, int end);
@@ -211,10 +258,14 @@ public:
     void emitChanges();
 
     void emitUnresolvedChanged() { Q_EMIT unresolvedChanged(); }
+    void emitPooled() { Q_EMIT pooled(); }
+    void emitReused() { Q_EMIT reused(); }
 
 Q_SIGNALS:
     void groupsChanged();
     void unresolvedChanged();
+    void pooled();
+    void reused();
 
 public:
     QQmlDelegateModelItem *m_cacheItem;
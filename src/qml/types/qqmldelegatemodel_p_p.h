@@ -269,6 +269,29 @@ public:
 
     void updateFilterGroup();
 
+    bool poolItem(QQmlDelegateModelItem *cacheItem);
+    QQmlDelegateModelItem *reuseItem(Compositor::iterator it);
+    void drainReusableItems();
+
+    void requestCachedPages();
+    void insertListItems(int index, int count);
+    void removeListItems(int index, int count);
+    void moveListItems(int from, int to, int count);
+
+    bool applyDataChange(int index, int count, const QVector<int> &roles);
+    void queueDataChange(int index, int count, const QVector<int> &roles);
+    void updatePendingDataChanges(int removeIndex, int removeCount, int insertIndex, int insertCount);
+    void flushDataChanges();
+
+    QString keyValue(int index) const;
+    void resetKeys();
+    bool applyKeyedReset();
+
+    bool updateSortAndFilter();
+    bool sortAndFilterDependOn(const QVector<int> &roles) const;
+    void filterItems();
+    void sortItems();
+
     void addGroups(Compositor::iterator from, int count, Compositor::Group group, int groupFlags);
     void removeGroups(Compositor::iterator from, int count, Compositor::Group group, int groupFlags);
     void setGroups(Compositor::iterator from, int count, Compositor::Group group, int groupFlags);
@@ -308,20 +331,40 @@ public:
     QQmlDelegateModelGroupEmitterList m_pendingParts;
 
     QList<QQmlDelegateModelItem *> m_cache;
+    QList<QQmlDelegateModelItem *> m_reusableItems;
     QList<QQDMIncubationTask *> m_finishedIncubating;
     QList<QByteArray> m_watchedRoles;
 
     QString m_filterGroup;
+    QString m_sortRole;
+    QString m_filterRole;
+    QVariant m_filterExpression;
+    QString m_keyRole;
+    QVector<QString> m_keys;
+
+    struct PendingDataChange
+    {
+        QVector<int> roles;
+        QVector<QQmlChangeSet::Change> ranges;
+    };
+    QVector<PendingDataChange> m_pendingDataChanges;
+    int m_coalescedDataChanges;
 
     int m_count;
     int m_groupCount;
 
     QQmlListCompositor::Group m_compositorGroup;
+    Qt::SortOrder m_sortOrder;
     bool m_complete : 1;
     bool m_delegateValidated : 1;
     bool m_reset : 1;
     bool m_transaction : 1;
     bool m_incubatorCleanupScheduled : 1;
+    bool m_filtered : 1;
+    bool m_reuseItems : 1;
+    bool m_batchDataChanges : 1;
+    bool m_dataChangesScheduled : 1;
+    bool m_applyingKeyedReset : 1;
 
     union {
         struct {
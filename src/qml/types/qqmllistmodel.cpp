@@ -294,8 +294,8 @@ void ListModel::sync(ListModel *src, ListModel *target, QHash<int, ListModel *>
     while (it != end) {
         const ElementSync &s = it.value();
         if (s.src == 0) {
+            // target->elements is rebuilt from the source below
             s.target->destroy(target->m_layout);
-            target->elements.removeOne(s.target);
             delete s.target;
         }
         ++it;
@@ -304,28 +304,34 @@ void ListModel::sync(ListModel *src, ListModel *target, QHash<int, ListModel *>
     // Sync the layouts
     ListLayout::sync(src->m_layout, target->m_layout);
 
-    // Clear the target list, and append in correct order from the source
+    // Clear the target list, and append in correct order from the source.  Only
+    // the values of new elements and of elements changed since the last sync are
+    // copied; the others are reused as they are.
     target->elements.clear();
+    target->elements.reserve(src->elements.count());
+    QPODVector<ListElement *, 4> updatedElements;
     for (int i=0 ; i < src->elements.count() ; ++i) {
         ListElement *srcElement = src->elements.at(i);
         it = elementHash.find(srcElement->getUid());
         const ElementSync &s = it.value();
         ListElement *targetElement = s.target;
+        bool copyValues = srcElement->m_dirty;
         if (targetElement == 0) {
             targetElement = new ListElement(srcElement->getUid());
+            copyValues = true;
         }
-        ListElement::sync(srcElement, src->m_layout, targetElement, target->m_layout, targetModelHash);
+        if (ListElement::sync(srcElement, src->m_layout, targetElement, target->m_layout, targetModelHash, copyValues)
+                && targetElement->m_objectCache)
+            updatedElements.append(targetElement);
+        targetElement->m_dirty = false;
         target->elements.append(targetElement);
     }
 
     target->updateCacheIndices();
 
     // Update values stored in target meta objects
-    for (int i=0 ; i < target->elements.count() ; ++i) {
-        ListElement *e = target->elements[i];
-        if (e->m_objectCache)
-            e->m_objectCache->updateValues();
-    }
+    for (int i=0 ; i < updatedElements.count() ; ++i)
+        updatedElements[i]->m_objectCache->updateValues();
 }
 
 ListModel::ListModel(ListLayout *layout, QQmlListModel *modelCache, int uid) : m_layout(layout), m_modelCache(modelCache)
@@ -358,6 +364,23 @@ void ListModel::insertElement(int index)
     updateCacheIndices();
 }
 
+/*
+Inserts \a count empty elements at \a index, moving the existing elements and
+updating the cached indices only once.
+*/
+void ListModel::insertElements(int index, int count)
+{
+    if (count <= 0)
+        return;
+
+    elements.insertBlank(index, count);
+    for (int i=0 ; i < count ; ++i)
+        elements[index+i] = new ListElement;
+
+    if (index + count < elements.count())
+        updateCacheIndices();
+}
+
 void ListModel::move(int from, int to, int n)
 {
     if (from > to) {
@@ -382,6 +405,10 @@ void ListModel::move(int from, int to, int n)
 
 void ListModel::newElement(int index)
 {
+    // QPODVector grows linearly, which makes appending large models quadratic
+    if (elements.count() == elements.capacity())
+        elements.reserve(qMax(4, elements.count() * 2));
+
     ListElement *e = new ListElement;
     elements.insert(index, e);
 }
@@ -412,6 +439,7 @@ ListModel *ListModel::getListProperty(int elementIndex, const ListLayout::Role &
 void ListModel::set(int elementIndex, QV4::ObjectRef object, QVector<int> *roles, QV8Engine *eng)
 {
     ListElement *e = elements[elementIndex];
+    e->m_dirty = true;
 
     QV4::ExecutionEngine *v4 = object->engine();
     QV4::Scope scope(v4);
@@ -486,6 +514,7 @@ void ListModel::set(int elementIndex, QV4::ObjectRef object, QVector<int> *roles
 void ListModel::set(int elementIndex, QV4::ObjectRef object, QV8Engine *eng)
 {
     ListElement *e = elements[elementIndex];
+    e->m_dirty = true;
 
     QV4::ExecutionEngine *v4 = object->engine();
     QV4::Scope scope(v4);
@@ -599,6 +628,7 @@ int ListModel::setOrCreateProperty(int elementIndex, const QString &key, const Q
 
         const ListLayout::Role *r = m_layout->getRoleOrCreate(key, data);
         if (r) {
+            e->m_dirty = true;
             roleIndex = e->setVariantProperty(*r, data);
 
             if (roleIndex != -1 && e->m_objectCache) {
@@ -619,8 +649,10 @@ int ListModel::setExistingProperty(int elementIndex, const QString &key, const Q
     if (elementIndex >= 0 && elementIndex < elements.count()) {
         ListElement *e = elements[elementIndex];
         const ListLayout::Role *r = m_layout->getExistingRole(key);
-        if (r)
+        if (r) {
+            e->m_dirty = true;
             roleIndex = e->setJsProperty(*r, data, eng);
+        }
     }
 
     return roleIndex;
@@ -1013,6 +1045,7 @@ ListElement::ListElement()
 {
     m_objectCache = 0;
     uid = uidCounter.fetchAndAddOrdered(1);
+    m_dirty = true;
     next = 0;
     memset(data, 0, sizeof(data));
 }
@@ -1021,6 +1054,7 @@ ListElement::ListElement(int existingUid)
 {
     m_objectCache = 0;
     uid = existingUid;
+    m_dirty = true;
     next = 0;
     memset(data, 0, sizeof(data));
 }
@@ -1030,12 +1064,20 @@ ListElement::~ListElement()
     delete next;
 }
 
-void ListElement::sync(ListElement *src, ListLayout *srcLayout, ListElement *target, ListLayout *targetLayout, QHash<int, ListModel *> *targetModelHash)
+/*
+Copies the values of \a src into \a target if \a copyValues is true, and returns
+whether it did.  Nested list models are synced regardless, as their elements
+track their own changes.
+*/
+bool ListElement::sync(ListElement *src, ListLayout *srcLayout, ListElement *target, ListLayout *targetLayout, QHash<int, ListModel *> *targetModelHash, bool copyValues)
 {
     for (int i=0 ; i < srcLayout->roleCount() ; ++i) {
         const ListLayout::Role &srcRole = srcLayout->getExistingRole(i);
         const ListLayout::Role &targetRole = targetLayout->getExistingRole(i);
 
+        if (!copyValues && srcRole.type != ListLayout::Role::List)
+            continue;
+
         switch (srcRole.type) {
             case ListLayout::Role::List:
                 {
@@ -1065,6 +1107,7 @@ void ListElement::sync(ListElement *src, ListLayout *srcLayout, ListElement *tar
                     QVariant v = src->getProperty(srcRole, 0, 0);
                     target->setVariantProperty(targetRole, v);
                 }
+                break;
             case ListLayout::Role::VariantMap:
                 {
                     QVariantMap *map = src->getVariantMapProperty(srcRole);
@@ -1076,6 +1119,8 @@ void ListElement::sync(ListElement *src, ListLayout *srcLayout, ListElement *tar
         }
     }
 
+    src->m_dirty = false;
+    return copyValues;
 }
 
 void ListElement::destroy(ListLayout *layout)
@@ -1954,13 +1999,18 @@ void QQmlListModel::insert(QQmlV4Function *args)
             QV4::ScopedObject argObject(scope);
 
             int objectArrayLength = objectArray->arrayLength();
+            if (m_dynamicRoles)
+                m_modelObjects.insert(index, objectArrayLength, 0);
+            else
+                m_listModel->insertElements(index, objectArrayLength);
+
             for (int i=0 ; i < objectArrayLength ; ++i) {
                 argObject = objectArray->getIndexed(i);
 
                 if (m_dynamicRoles) {
-                    m_modelObjects.insert(index+i, DynamicRoleModelNode::create(args->engine()->variantMapFromJS(argObject), this));
-                } else {
-                    m_listModel->insert(index+i, argObject, args->engine());
+                    m_modelObjects[index+i] = DynamicRoleModelNode::create(args->engine()->variantMapFromJS(argObject), this);
+                } else if (argObject) {
+                    m_listModel->set(index+i, argObject, args->engine());
                 }
             }
             emitItemsInserted(index, objectArrayLength);
@@ -2043,6 +2093,10 @@ void QQmlListModel::move(int from, int to, int n)
         fruitModel.append({"cost": 5.95, "name":"Pizza"})
     \endcode
 
+    If \a dict is an array of objects, each of them is appended as a new item.
+    The items are added in a single change, which is considerably faster than
+    appending them one at a time when populating large models.
+
     \sa set(), remove()
 */
 void QQmlListModel::append(QQmlV4Function *args)
@@ -2058,13 +2112,18 @@ void QQmlListModel::append(QQmlV4Function *args)
             int objectArrayLength = objectArray->arrayLength();
 
             int index = count();
+            if (m_dynamicRoles)
+                m_modelObjects.reserve(index + objectArrayLength);
+            else
+                m_listModel->insertElements(index, objectArrayLength);
+
             for (int i=0 ; i < objectArrayLength ; ++i) {
                 argObject = objectArray->getIndexed(i);
 
                 if (m_dynamicRoles) {
                     m_modelObjects.append(DynamicRoleModelNode::create(args->engine()->variantMapFromJS(argObject), this));
-                } else {
-                    m_listModel->append(argObject, args->engine());
+                } else if (argObject) {
+                    m_listModel->set(index+i, argObject, args->engine());
                 }
             }
 
@@ -240,7 +240,7 @@ public:
     ListElement(int existingUid);
     ~ListElement();
 
-    static void sync(ListElement *src, ListLayout *srcLayout, ListElement *target, ListLayout *targetLayout, QHash<int, ListModel *> *targetModelHash);
+    static bool sync(ListElement *src, ListLayout *srcLayout, ListElement *target, ListLayout *targetLayout, QHash<int, ListModel *> *targetModelHash, bool copyValues);
 
     enum
     {
@@ -290,6 +290,7 @@ private:
     ListElement *next;
 
     int uid;
+    bool m_dirty; // Set when values changed since the element was last synced from
     ModelObject *m_objectCache;
 
     friend class ListModel;
@@ -344,6 +345,7 @@ public:
 
     int appendElement();
     void insertElement(int index);
+    void insertElements(int index, int count);
 
     void move(int from, int to, int n);
 
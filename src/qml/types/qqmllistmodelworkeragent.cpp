@@ -88,7 +88,7 @@ void QQmlListModelWorkerAgent::Data::changedChange(int uid, int index, int count
 }
 
 QQmlListModelWorkerAgent::QQmlListModelWorkerAgent(QQmlListModel *model)
-: m_ref(1), m_orig(model), m_copy(new QQmlListModel(model, this))
+: m_ref(1), m_orig(model), m_copy(new QQmlListModel(model, this)), m_workerScriptEngine(0)
 {
 }
 
@@ -64,6 +64,7 @@ QT_BEGIN_NAMESPACE
 
 
 class QQmlListModel;
+class QQuickWorkerScriptEngine;
 
 class QQmlListModelWorkerAgent : public QObject
 {
@@ -112,6 +113,7 @@ protected:
 
 private:
     friend class QQuickWorkerScriptEnginePrivate;
+    friend class QQuickWorkerScript;
     friend class QQmlListModel;
 
     struct Change
@@ -145,6 +147,8 @@ private:
     QAtomicInt m_ref;
     QQmlListModel *m_orig;
     QQmlListModel *m_copy;
+    // The worker engine whose scripts may use m_copy, only accessed in the main thread
+    QQuickWorkerScriptEngine *m_workerScriptEngine;
     QMutex mutex;
     QWaitCondition syncDone;
 };
@@ -55,6 +55,8 @@ void QQmlModelsModule::defineModule()
     qmlRegisterType<QQmlDelegateModel>(uri, 2, 1, "DelegateModel");
     qmlRegisterType<QQmlDelegateModelGroup>(uri, 2, 1, "DelegateModelGroup");
     qmlRegisterType<QQmlObjectModel>(uri, 2, 1, "ObjectModel");
+
+    qmlRegisterType<QQmlDelegateModel, 1>(uri, 2, 2, "DelegateModel");
 }
 
 QT_END_NAMESPACE
@@ -78,7 +78,7 @@ public:
     virtual ~WorkerDataEvent();
 
     int workerId() const;
-    QByteArray data() const;
+    QByteArray takeData();
 
 private:
     int m_id;
@@ -295,6 +295,8 @@ QV4::ReturnedValue QQuickWorkerScriptEnginePrivate::method_sendMessage(QV4::Call
     WorkerScript *script = engine->p->workers.value(id);
     if (script && script->owner)
         QCoreApplication::postEvent(script->owner, new WorkerDataEvent(0, data));
+    else
+        QV4::Serialize::release(data);
 
     return QV4::Encode::undefined();
 }
@@ -329,7 +331,7 @@ bool QQuickWorkerScriptEnginePrivate::event(QEvent *event)
 {
     if (event->type() == (QEvent::Type)WorkerDataEvent::WorkerData) {
         WorkerDataEvent *workerEvent = static_cast<WorkerDataEvent *>(event);
-        processMessage(workerEvent->workerId(), workerEvent->data());
+        processMessage(workerEvent->workerId(), workerEvent->takeData());
         return true;
     } else if (event->type() == (QEvent::Type)WorkerLoadEvent::WorkerLoad) {
         WorkerLoadEvent *workerEvent = static_cast<WorkerLoadEvent *>(event);
@@ -350,8 +352,10 @@ bool QQuickWorkerScriptEnginePrivate::event(QEvent *event)
 void QQuickWorkerScriptEnginePrivate::processMessage(int id, const QByteArray &data)
 {
     WorkerScript *script = workers.value(id);
-    if (!script)
+    if (!script) {
+        QV4::Serialize::release(data);
         return;
+    }
 
     QV4::ExecutionEngine *v4 = QV8Engine::getV4(workerEngine);
     QV4::Scope scope(v4);
@@ -428,6 +432,8 @@ WorkerDataEvent::WorkerDataEvent(int workerId, const QByteArray &data)
 
 WorkerDataEvent::~WorkerDataEvent()
 {
+    // Not delivered, or dropped by the receiver
+    QV4::Serialize::release(m_data);
 }
 
 int WorkerDataEvent::workerId() const
@@ -435,9 +441,15 @@ int WorkerDataEvent::workerId() const
     return m_id;
 }
 
-QByteArray WorkerDataEvent::data() const
+/*
+Hands the data over to the receiver, which has to either deserialize it or pass it to
+QV4::Serialize::release().
+*/
+QByteArray WorkerDataEvent::takeData()
 {
-    return m_data;
+    QByteArray data = m_data;
+    m_data.clear();
+    return data;
 }
 
 WorkerLoadEvent::WorkerLoadEvent(int workerId, const QUrl &url)
@@ -476,7 +488,7 @@ QQmlError WorkerErrorEvent::error() const
 }
 
 QQuickWorkerScriptEngine::QQuickWorkerScriptEngine(QQmlEngine *parent)
-: QThread(parent), d(new QQuickWorkerScriptEnginePrivate(parent))
+: QThread(parent), d(new QQuickWorkerScriptEnginePrivate(parent)), m_scriptCount(0)
 {
     d->m_lock.lock();
     connect(d, SIGNAL(stopThread()), this, SLOT(quit()), Qt::DirectConnection);
@@ -526,6 +538,8 @@ int QQuickWorkerScriptEngine::registerWorkerScript(QQuickWorkerScript *owner)
     d->workers.insert(script->id, script);
     d->m_lock.unlock();
 
+    ++m_scriptCount;
+
     return script->id;
 }
 
@@ -534,6 +548,7 @@ void QQuickWorkerScriptEngine::removeWorkerScript(int id)
     QQuickWorkerScriptEnginePrivate::WorkerScript* script = d->workers.value(id);
     if (script) {
         script->owner = 0;
+        --m_scriptCount;
         QCoreApplication::postEvent(d, new WorkerRemoveEvent(id));
     }
 }
@@ -611,6 +626,14 @@ void QQuickWorkerScriptEngine::run()
 
     Worker script can not use \l {qtqml-javascript-imports.html}{.import} syntax.
 
+    By default all WorkerScript instances run in a single thread. Setting the
+    \c QML_WORKERSCRIPT_THREADS environment variable to a larger number spreads
+    them over a pool of up to that many threads, so that a long running script
+    does not delay the messages of the others. Each instance stays in the thread
+    it was first assigned to. With more than one thread, a ListModel can only be
+    sent to the worker scripts of the thread it was first sent to; sending it to
+    a script in another thread prints a warning and the message is dropped.
+
     \sa {declarative/threading/workerscript}{WorkerScript example},
         {declarative/threading/threadedlistmodel}{Threaded ListModel example}
 */
@@ -680,7 +703,34 @@ void QQuickWorkerScript::sendMessage(QQmlV4Function *args)
     if (args->length() != 0)
         argument = (*args)[0];
 
-    m_engine->sendMessage(m_scriptId, QV4::Serialize::serialize(argument, args->engine()));
+    QByteArray data = QV4::Serialize::serialize(argument, args->engine());
+    if (!claimListModels(data)) {
+        qmlInfo(this) << "Cannot send a ListModel that is used by a WorkerScript in another thread";
+        QV4::Serialize::release(data);
+        return;
+    }
+
+    m_engine->sendMessage(m_scriptId, data);
+}
+
+/*
+The worker copy of a ListModel may only be used by the scripts of one worker engine.
+The first script a ListModel is sent to claims it for its engine.  Scripts are not
+moved to the engine owning a ListModel, as their source has already been evaluated
+in their own engine and evaluating it again would run its top-level code twice.
+*/
+bool QQuickWorkerScript::claimListModels(const QByteArray &data)
+{
+    const QList<QQmlListModelWorkerAgent *> agents = QV4::Serialize::listModelAgents(data);
+
+    foreach (QQmlListModelWorkerAgent *agent, agents) {
+        if (agent->m_workerScriptEngine && agent->m_workerScriptEngine != m_engine)
+            return false;
+    }
+
+    foreach (QQmlListModelWorkerAgent *agent, agents)
+        agent->m_workerScriptEngine = m_engine;
+    return true;
 }
 
 void QQuickWorkerScript::classBegin()
@@ -730,7 +780,7 @@ bool QQuickWorkerScript::event(QEvent *event)
             WorkerDataEvent *workerEvent = static_cast<WorkerDataEvent *>(event);
             QV8Engine *v8engine = QQmlEnginePrivate::get(engine)->v8engine();
             QV4::Scope scope(QV8Engine::getV4(v8engine));
-            QV4::ScopedValue value(scope, QV4::Serialize::deserialize(workerEvent->data(), v8engine));
+            QV4::ScopedValue value(scope, QV4::Serialize::deserialize(workerEvent->takeData(), v8engine));
             emit message(QQmlV4Handle(value));
         }
         return true;
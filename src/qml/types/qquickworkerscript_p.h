@@ -77,11 +77,14 @@ public:
     void executeUrl(int, const QUrl &);
     void sendMessage(int, const QByteArray &);
 
+    int workerScriptCount() const { return m_scriptCount; }
+
 protected:
     virtual void run();
 
 private:
     QQuickWorkerScriptEnginePrivate *d;
+    int m_scriptCount;
 };
 
 class QQmlV4Function;
@@ -113,6 +116,7 @@ protected:
 
 private:
     QQuickWorkerScriptEngine *engine();
+    bool claimListModels(const QByteArray &);
     QQuickWorkerScriptEngine *m_engine;
     int m_scriptId;
     QUrl m_source;
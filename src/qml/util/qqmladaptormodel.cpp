@@ -442,6 +442,8 @@ class VDMAbstractItemModelDataType : public VDMModelDelegateDataType
 public:
     VDMAbstractItemModelDataType(QQmlAdaptorModel *model)
         : VDMModelDelegateDataType(model)
+        , fetchRowsMethod(-2)
+        , releaseRowsMethod(-1)
     {
     }
 
@@ -464,8 +466,12 @@ public:
                                 vdm, SLOT(_q_dataChanged(QModelIndex,QModelIndex,QVector<int>)));
             QObject::disconnect(aim, SIGNAL(rowsMoved(QModelIndex,int,int,QModelIndex,int)),
                                 vdm, SLOT(_q_rowsMoved(QModelIndex,int,int,QModelIndex,int)));
+            QObject::disconnect(aim, SIGNAL(modelAboutToBeReset()),
+                                vdm, SLOT(_q_modelAboutToBeReset()));
             QObject::disconnect(aim, SIGNAL(modelReset()),
                                 vdm, SLOT(_q_modelReset()));
+            QObject::disconnect(aim, SIGNAL(layoutAboutToBeChanged()),
+                                vdm, SLOT(_q_modelAboutToBeReset()));
             QObject::disconnect(aim, SIGNAL(layoutChanged()),
                                 vdm, SLOT(_q_layoutChanged()));
         }
@@ -480,9 +486,13 @@ public:
             return model.aim()->index(index, 0, model.rootIndex).data(*it);
         } else if (role == QLatin1String("hasModelChildren")) {
             return QVariant(model.aim()->hasChildren(model.aim()->index(index, 0, model.rootIndex)));
-        } else {
-            return QVariant();
+        } else if (!metaObject) {
+            // The role names are only cached once the first item has been created.
+            const int roleId = model.aim()->roleNames().key(role.toUtf8(), -1);
+            if (roleId != -1)
+                return model.aim()->index(index, 0, model.rootIndex).data(roleId);
         }
+        return QVariant();
     }
 
     QVariant parentModelIndex(const QQmlAdaptorModel &model) const
@@ -510,6 +520,38 @@ public:
             model.aim()->fetchMore(model.rootIndex);
     }
 
+    bool canFetchRows(const QQmlAdaptorModel &model) const
+    {
+        if (!model)
+            return false;
+        if (fetchRowsMethod == -2) {
+            const QMetaObject *meta = model.aim()->metaObject();
+            VDMAbstractItemModelDataType *self = const_cast<VDMAbstractItemModelDataType *>(this);
+            self->fetchRowsMethod = meta->indexOfMethod("fetchRows(QModelIndex,int,int)");
+            self->releaseRowsMethod = meta->indexOfMethod("releaseRows(QModelIndex,int,int)");
+        }
+        return fetchRowsMethod != -1;
+    }
+
+    void fetchRows(QQmlAdaptorModel &model, int index, int count) const
+    {
+        invokeRowsMethod(model, fetchRowsMethod, index, count);
+    }
+
+    void releaseRows(QQmlAdaptorModel &model, int index, int count) const
+    {
+        invokeRowsMethod(model, releaseRowsMethod, index, count);
+    }
+
+    void invokeRowsMethod(QQmlAdaptorModel &model, int methodIndex, int index, int count) const
+    {
+        if (model && methodIndex >= 0) {
+            const QModelIndex parent = model.rootIndex;
+            model.aim()->metaObject()->method(methodIndex).invoke(
+                    model.aim(), Q_ARG(QModelIndex, parent), Q_ARG(int, index), Q_ARG(int, count));
+        }
+    }
+
     QQmlDelegateModelItem *createItem(
             QQmlAdaptorModel &model,
             QQmlDelegateModelItemMetaType *metaType,
@@ -549,6 +591,9 @@ public:
         *static_cast<QMetaObject *>(this) = *metaObject;
         propertyCache = new QQmlPropertyCache(engine, metaObject);
     }
+
+    int fetchRowsMethod;
+    int releaseRowsMethod;
 };
 
 //-----------------------------------------------------------------
@@ -888,16 +933,20 @@ QQmlAdaptorModel::Accessors::~Accessors()
 
 QQmlAdaptorModel::QQmlAdaptorModel()
     : accessors(&qt_vdm_null_accessors)
+    , pageSize(0)
+    , pageCacheSize(16)
 {
 }
 
 QQmlAdaptorModel::~QQmlAdaptorModel()
 {
+    releasePages();
     accessors->cleanup(*this);
 }
 
 void QQmlAdaptorModel::setModel(const QVariant &variant, QQmlDelegateModel *vdm, QQmlEngine *engine)
 {
+    releasePages();
     accessors->cleanup(*this, vdm);
 
     list.setList(variant, engine);
@@ -917,8 +966,12 @@ void QQmlAdaptorModel::setModel(const QVariant &variant, QQmlDelegateModel *vdm,
                               vdm, QQmlDelegateModel, SLOT(_q_dataChanged(QModelIndex,QModelIndex,QVector<int>)));
             qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsMoved(QModelIndex,int,int,QModelIndex,int)),
                               vdm, QQmlDelegateModel, SLOT(_q_rowsMoved(QModelIndex,int,int,QModelIndex,int)));
+            qmlobject_connect(model, QAbstractItemModel, SIGNAL(modelAboutToBeReset()),
+                              vdm, QQmlDelegateModel, SLOT(_q_modelAboutToBeReset()));
             qmlobject_connect(model, QAbstractItemModel, SIGNAL(modelReset()),
                               vdm, QQmlDelegateModel, SLOT(_q_modelReset()));
+            qmlobject_connect(model, QAbstractItemModel, SIGNAL(layoutAboutToBeChanged()),
+                              vdm, QQmlDelegateModel, SLOT(_q_modelAboutToBeReset()));
             qmlobject_connect(model, QAbstractItemModel, SIGNAL(layoutChanged()),
                               vdm, QQmlDelegateModel, SLOT(_q_layoutChanged()));
         } else {
@@ -950,6 +1003,123 @@ bool QQmlAdaptorModel::isValid() const
     return accessors != &qt_vdm_null_accessors;
 }
 
+/*
+    Records that the item at \a index is needed, if the model fetches its rows on demand.
+
+    Rows are fetched a page of pageSize rows at a time.  Returns true if the page containing
+    \a index is the first one requested since the last call to fetchRequestedPages(), in which
+    case the caller should schedule a call to that.  Requests for pages which have already
+    been fetched only mark the page as recently used.
+*/
+bool QQmlAdaptorModel::requestPage(int index)
+{
+    if (pageSize <= 0 || !accessors->canFetchRows(*this))
+        return false;
+
+    const int page = index / pageSize;
+    const int fetchedIndex = fetchedPages.indexOf(page);
+    if (fetchedIndex != -1) {
+        fetchedPages.move(fetchedIndex, fetchedPages.count() - 1);
+        return false;
+    } else if (requestedPages.contains(page)) {
+        return false;
+    }
+    requestedPages.append(page);
+    return requestedPages.count() == 1;
+}
+
+/*
+    Asks the model to fetch the rows of the requested pages, and to release the rows of the
+    least recently used pages once more than pageCacheSize pages have been fetched.
+*/
+void QQmlAdaptorModel::fetchRequestedPages()
+{
+    const QList<int> pages = requestedPages;
+    requestedPages.clear();
+    if (pageSize <= 0 || !accessors->canFetchRows(*this))
+        return;
+
+    const int rowCount = count();
+    foreach (int page, pages) {
+        const int index = page * pageSize;
+        if (index >= rowCount)
+            continue;
+        fetchedPages.append(page);
+        accessors->fetchRows(*this, index, qMin(pageSize, rowCount - index));
+    }
+
+    while (fetchedPages.count() > qMax(1, pageCacheSize)) {
+        const int index = fetchedPages.takeFirst() * pageSize;
+        if (index < rowCount)
+            accessors->releaseRows(*this, index, qMin(pageSize, rowCount - index));
+    }
+}
+
+/*
+    Forgets which pages have been fetched, for when the rows of the model no longer match the
+    pages.
+*/
+void QQmlAdaptorModel::resetPages()
+{
+    fetchedPages.clear();
+    requestedPages.clear();
+}
+
+static int qt_movedRow(int row, int from, int to, int count)
+{
+    if (from == -1)
+        return row >= to ? row + count : row;
+    if (row >= from && row < from + count)
+        return to == -1 ? -1 : row - from + to;
+    if (row >= from + count)
+        row -= count;
+    return to != -1 && row >= to ? row + count : row;
+}
+
+/*
+    Asks the model to release the rows of the fetched pages and then forgets the pages.
+
+    If the rows of the model have changed since the pages were fetched the rows are released at
+    their current index.  \a count rows have been inserted at \a to if \a from is -1, removed
+    from \a from if \a to is -1, and otherwise moved from \a from to \a to.  Removed rows are
+    gone from the model and aren't released.
+*/
+void QQmlAdaptorModel::releasePages(int from, int to, int count)
+{
+    const QList<int> pages = fetchedPages;
+    resetPages();
+    if (pages.isEmpty() || !accessors->canFetchRows(*this))
+        return;
+
+    const int rowCount = this->count();
+    int previousRowCount = rowCount;
+    if (from == -1)
+        previousRowCount -= count;
+    else if (to == -1)
+        previousRowCount += count;
+
+    // A page's rows may have been split up by the change, consecutive rows are released
+    // together.
+    foreach (int page, pages) {
+        int index = -1;
+        int length = 0;
+        for (int row = page * pageSize, end = qMin(row + pageSize, previousRowCount); row < end; ++row) {
+            const int movedRow = qt_movedRow(row, from, to, count);
+            const bool valid = movedRow >= 0 && movedRow < rowCount;
+            if (valid && movedRow == index + length) {
+                ++length;
+                continue;
+            }
+            if (length > 0)
+                accessors->releaseRows(*this, index, length);
+            index = movedRow;
+            length = valid ? 1 : 0;
+        }
+        if (length > 0)
+            accessors->releaseRows(*this, index, length);
+    }
+}
+
 void QQmlAdaptorModel::objectDestroyed(QObject *)
 {
     setModel(QVariant(), 0, 0);
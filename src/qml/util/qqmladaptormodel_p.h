@@ -92,12 +92,20 @@ public:
             return QVariant(); }
         virtual bool canFetchMore(const QQmlAdaptorModel &) const { return false; }
         virtual void fetchMore(QQmlAdaptorModel &) const {}
+        virtual bool canFetchRows(const QQmlAdaptorModel &) const { return false; }
+        virtual void fetchRows(QQmlAdaptorModel &, int, int) const {}
+        virtual void releaseRows(QQmlAdaptorModel &, int, int) const {}
     };
 
     const Accessors *accessors;
     QPersistentModelIndex rootIndex;
     QQmlListAccessor list;
 
+    int pageSize;
+    int pageCacheSize;
+    QList<int> fetchedPages;
+    QList<int> requestedPages;
+
     QQmlAdaptorModel();
     ~QQmlAdaptorModel();
 
@@ -133,6 +141,11 @@ public:
     inline bool canFetchMore() const { return accessors->canFetchMore(*this); }
     inline void fetchMore() { return accessors->fetchMore(*this); }
 
+    bool requestPage(int index);
+    void fetchRequestedPages();
+    void resetPages();
+    void releasePages(int from = -1, int to = -1, int count = 0);
+
 protected:
     void objectDestroyed(QObject *);
 };
@@ -98,8 +98,13 @@ QT_BEGIN_NAMESPACE
     for a specific index, each time a lookup is done the range and its indexes are cached and the
     next lookup is done relative to this.   This works out to near constant time in most relevant
     use cases because successive index lookups are most frequently adjacent.  The total number of
-    ranges is often quite small, which helps as well. If there is a need for faster random access
-    then a skip list like index may be an appropriate addition.
+    ranges is often quite small, which helps as well.
+
+    For faster random access when there are many ranges, a sparse index records the indexes of
+    every group at the start of every IndexInterval'th range.  A lookup then binary searches the
+    index for the last entry before the wanted index and walks at most IndexInterval ranges from
+    there.  The index is discarded by any change to the ranges and only rebuilt once the lookups
+    since then have walked over more ranges than rebuilding it costs.
 
     \sa VisualDataModel
 */
@@ -233,8 +238,16 @@ static bool qt_verifyIntegrity(
 //#define QT_QML_TRACE_LISTCOMPOSITOR(args) qDebug() << m_end.index[1] << m_end.index[0] << Q_FUNC_INFO args;
 #define QT_QML_TRACE_LISTCOMPOSITOR(args)
 
-QQmlListCompositor::iterator &QQmlListCompositor::iterator::operator +=(int difference)
+/*!
+    Moves the iterator by \a difference items in its group.
+
+    Returns the number of ranges that were stepped over.
+*/
+
+int QQmlListCompositor::iterator::advance(int difference)
 {
+    int steps = 0;
+
     // Update all indexes to the start of the range.
     decrementIndexes(offset);
 
@@ -250,6 +263,7 @@ QQmlListCompositor::iterator &QQmlListCompositor::iterator::operator +=(int diff
         if (range->flags & groupFlag)
             offset += range->count;
         decrementIndexes(range->count);
+        ++steps;
     }
 
     // Iterate forwards looking for the first range which contains both the offset and the
@@ -259,12 +273,13 @@ QQmlListCompositor::iterator &QQmlListCompositor::iterator::operator +=(int diff
             offset -= range->count;
         incrementIndexes(range->count);
         range = range->next;
+        ++steps;
     }
 
     // Update all the indexes to inclue the remaining offset.
     incrementIndexes(offset);
 
-    return *this;
+    return steps;
 }
 
 QQmlListCompositor::insert_iterator &QQmlListCompositor::insert_iterator::operator +=(int difference)
@@ -293,6 +308,9 @@ QQmlListCompositor::QQmlListCompositor()
     , m_defaultFlags(PrependFlag | DefaultFlag)
     , m_removeFlags(AppendFlag | PrependFlag | GroupMask)
     , m_moveId(0)
+    , m_rangeCount(0)
+    , m_walkedRanges(0)
+    , m_indexValid(false)
 {
 }
 
@@ -316,6 +334,7 @@ QQmlListCompositor::~QQmlListCompositor()
 inline QQmlListCompositor::Range *QQmlListCompositor::insert(
         Range *before, void *list, int index, int count, uint flags)
 {
+    ++m_rangeCount;
     return new Range(before, list, index, count, flags);
 }
 
@@ -332,15 +351,81 @@ inline QQmlListCompositor::Range *QQmlListCompositor::erase(
     next->previous = range->previous;
     next->previous->next = range->next;
     delete range;
+    --m_rangeCount;
     return next;
 }
 
+/*!
+    Records the group indexes at the start of every IndexInterval'th range.
+*/
+
+void QQmlListCompositor::buildIndex()
+{
+    m_index.resize(0);
+    m_index.reserve(m_rangeCount / IndexInterval + 1);
+
+    iterator it(m_ranges.next, 0, Default, m_groupCount);
+    for (int i = 0; *it != &m_ranges; *it = it->next, ++i) {
+        if (i % IndexInterval == 0) {
+            IndexEntry entry;
+            entry.range = *it;
+            for (int j = 0; j < m_groupCount; ++j)
+                entry.index[j] = it.index[j];
+            m_index.append(entry);
+        }
+        it.incrementIndexes(it->count);
+    }
+    m_indexValid = !m_index.isEmpty();
+}
+
+/*!
+    Returns an iterator for the item at \a index in a \a group using the range index.
+
+    The returned iterator is positioned at the first range containing \a index that is a member
+    of \a group, the same position iterator::operator +=() would resolve to.
+*/
+
+QQmlListCompositor::iterator QQmlListCompositor::findIndexed(Group group, int index) const
+{
+    Q_ASSERT(m_indexValid);
+
+    // Find the last entry which starts at or before the wanted index.  The first entry always
+    // starts at 0 so there is always a match.
+    int low = 0;
+    int high = m_index.count() - 1;
+    while (low < high) {
+        const int mid = (low + high + 1) / 2;
+        if (m_index.at(mid).index[group] <= index)
+            low = mid;
+        else
+            high = mid - 1;
+    }
+
+    const IndexEntry &entry = m_index.at(low);
+    iterator it(entry.range, 0, group, m_groupCount);
+    for (int i = 0; i < m_groupCount; ++i)
+        it.index[i] = entry.index[i];
+
+    // Walk forward only, as walking back would step over any leading ranges outside the group.
+    int offset = index - entry.index[group];
+    while (it->flags && (offset >= it->count || !(it->flags & it.groupFlag))) {
+        if (it->flags & it.groupFlag)
+            offset -= it->count;
+        it.incrementIndexes(it->count);
+        *it = it->next;
+    }
+    it.offset = offset;
+    it.incrementIndexes(offset);
+    return it;
+}
+
 /*!
     Sets the number (\a count) of possible groups that items may belong to in a compositor.
 */
 
 void QQmlListCompositor::setGroupCount(int count)
 {
+    invalidateIndex();
     m_groupCount = count;
     m_end = iterator(&m_ranges, 0, Default, m_groupCount);
     m_cacheIt = m_end;
@@ -367,12 +452,24 @@ QQmlListCompositor::iterator QQmlListCompositor::find(Group group, int index)
     Q_ASSERT(index >=0 && index < count(group));
     if (m_cacheIt == m_end) {
         m_cacheIt = iterator(m_ranges.next, 0, group, m_groupCount);
-        m_cacheIt += index;
+        m_walkedRanges += m_cacheIt.advance(index);
+    } else if (m_cacheIt->inGroup(group)
+            && index >= m_cacheIt.index[group] - m_cacheIt.offset
+            && index < m_cacheIt.index[group] - m_cacheIt.offset + m_cacheIt->count) {
+        // The index is in the cached range, just move the offset.
+        const int offset = index - m_cacheIt.index[group];
+        m_cacheIt.setGroup(group);
+        m_cacheIt.incrementIndexes(offset);
+        m_cacheIt.offset += offset;
+    } else if (m_indexValid) {
+        m_cacheIt = findIndexed(group, index);
     } else {
         const int offset = index - m_cacheIt.index[group];
         m_cacheIt.setGroup(group);
-        m_cacheIt += offset;
+        m_walkedRanges += m_cacheIt.advance(offset);
     }
+    if (!m_indexValid && m_rangeCount > IndexInterval && m_walkedRanges > m_rangeCount)
+        buildIndex();
     Q_ASSERT(m_cacheIt.index[group] == index);
     Q_ASSERT(m_cacheIt->inGroup(group));
     QT_QML_VERIFY_LISTCOMPOSITOR
@@ -407,7 +504,14 @@ QQmlListCompositor::insert_iterator QQmlListCompositor::findInsertPosition(Group
     QT_QML_TRACE_LISTCOMPOSITOR(<< group << index)
     Q_ASSERT(index >=0 && index <= count(group));
     insert_iterator it;
-    if (m_cacheIt == m_end) {
+    if (m_indexValid) {
+        it = findIndexed(group, index);
+        // Match insert_iterator::operator +=().
+        if (it.offset == 0 && it->previous->append()) {
+            *it = it->previous;
+            it.offset = it->inGroup() ? it->count : 0;
+        }
+    } else if (m_cacheIt == m_end) {
         it = iterator(m_ranges.next, 0, group, m_groupCount);
         it += index;
     } else {
@@ -462,6 +566,7 @@ QQmlListCompositor::iterator QQmlListCompositor::insert(
         iterator before, void *list, int index, int count, uint flags, QVector<Insert> *inserts)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< before << list << index << count << flags)
+    invalidateIndex();
     if (inserts) {
         inserts->append(Insert(before, count, flags & GroupMask));
     }
@@ -533,6 +638,8 @@ void QQmlListCompositor::setFlags(
     if (!flags || !count)
         return;
 
+    invalidateIndex();
+
     if (from != group) {
         // Skip to the next full range if the start one is not a member of the target group.
         from.incrementIndexes(from->count - from.offset);
@@ -615,6 +722,129 @@ void QQmlListCompositor::setFlags(
     QT_QML_VERIFY_LISTCOMPOSITOR
 }
 
+/*!
+    Sets the given \a flags on every item of \a list whose index in the list is set in \a indexes,
+    regardless of the groups the item currently belongs to.
+
+    This visits each range once, so it is much cheaper than a setFlags() call per item when
+    many scattered items are affected.
+
+    If supplied the \a inserts list will be populated with insert notifications for affected groups.
+*/
+
+void QQmlListCompositor::setListFlags(
+        void *list, const QBitArray &indexes, uint flags, QVector<Insert> *inserts)
+{
+    QT_QML_TRACE_LISTCOMPOSITOR(<< list << indexes.count(true) << flags)
+    updateListFlags(list, indexes, flags, true, inserts, 0);
+}
+
+/*!
+    Clears the given \a flags on every item of \a list whose index in the list is set in
+    \a indexes.
+
+    If supplied the \a removes list will be populated with remove notifications for affected groups.
+*/
+
+void QQmlListCompositor::clearListFlags(
+        void *list, const QBitArray &indexes, uint flags, QVector<Remove> *removes)
+{
+    QT_QML_TRACE_LISTCOMPOSITOR(<< list << indexes.count(true) << flags)
+    updateListFlags(list, indexes, flags, false, 0, removes);
+}
+
+void QQmlListCompositor::updateListFlags(
+        void *list,
+        const QBitArray &indexes,
+        uint flags,
+        bool set,
+        QVector<Insert> *inserts,
+        QVector<Remove> *removes)
+{
+    flags &= GroupMask;
+    if (!flags)
+        return;
+
+    invalidateIndex();
+
+    for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges;) {
+        Range *range = *it;
+        if (range->list != list || range->flags == CacheFlag) {
+            // Skip ranges that don't reference list.
+            it.incrementIndexes(range->count);
+            *it = range->next;
+            continue;
+        }
+
+        const uint rangeFlags = range->flags;
+        const uint changeFlags = set ? (flags & ~rangeFlags) : (flags & rangeFlags);
+        bool changed = false;
+        for (int i = range->index; changeFlags && !changed && i < range->end(); ++i)
+            changed = i < indexes.size() && indexes.testBit(i);
+        if (!changed) {
+            it.incrementIndexes(range->count);
+            *it = range->next;
+            continue;
+        }
+
+        // Split the range into runs of items which end up with the same flags.
+        Range *next = range->next;
+        for (int start = 0; start < range->count;) {
+            const bool selected = range->index + start < indexes.size()
+                    && indexes.testBit(range->index + start);
+            int end = start + 1;
+            for (; end < range->count; ++end) {
+                const bool s = range->index + end < indexes.size() && indexes.testBit(range->index + end);
+                if (s != selected)
+                    break;
+            }
+            const int count = end - start;
+
+            uint runFlags = rangeFlags;
+            if (selected && set) {
+                if (inserts)
+                    inserts->append(Insert(it, count, changeFlags | (rangeFlags & CacheFlag)));
+                m_end.incrementIndexes(count, changeFlags);
+                runFlags |= changeFlags;
+            } else if (selected) {
+                const uint removeFlags = changeFlags & ~(AppendFlag | PrependFlag);
+                if (removeFlags && removes)
+                    removes->append(Remove(it, count, removeFlags | (rangeFlags & CacheFlag)));
+                m_end.decrementIndexes(count, removeFlags);
+                runFlags &= ~changeFlags;
+            }
+            if (end < range->count)
+                runFlags &= ~AppendFlag;
+
+            // Items left with no flags at all are dropped, as clearFlags() does.
+            if (runFlags & ~AppendFlag)
+                insert(range, list, range->index + start, count, runFlags);
+            it.incrementIndexes(count, runFlags);
+            start = end;
+        }
+        erase(range);
+        *it = next;
+    }
+
+    // Merge runs which are now continuations of their neighbours.
+    for (Range *range = m_ranges.next; range != &m_ranges && range->next != &m_ranges;) {
+        Range *next = range->next;
+        if (range->list == list
+                && next->list == list
+                && range->end() == next->index
+                && range->flags == (next->flags & ~AppendFlag)) {
+            range->count += next->count;
+            range->flags = next->flags;
+            erase(next);
+        } else {
+            range = next;
+        }
+    }
+
+    m_cacheIt = m_end;
+    QT_QML_VERIFY_LISTCOMPOSITOR
+}
+
 /*!
     Clears the given flags \a flags on \a count items belonging to \a group starting at the position
     \a from.
@@ -643,6 +873,8 @@ void QQmlListCompositor::clearFlags(
     if (!flags || !count)
         return;
 
+    invalidateIndex();
+
     const bool clearCache = flags & CacheFlag;
 
     if (from != group) {
@@ -782,6 +1014,7 @@ void QQmlListCompositor::move(
 
     // Find the position of the first item to move.
     iterator fromIt = find(fromGroup, from);
+    invalidateIndex();
 
     if (fromIt != moveGroup) {
         // If the range at the from index doesn't contain items from the move group; skip
@@ -943,6 +1176,7 @@ void QQmlListCompositor::move(
 void QQmlListCompositor::clear()
 {
     QT_QML_TRACE_LISTCOMPOSITOR("")
+    invalidateIndex();
     for (Range *range = m_ranges.next; range != &m_ranges; range = erase(range)) {}
     m_end = iterator(m_ranges.next, 0, Default, m_groupCount);
     m_cacheIt = m_end;
@@ -955,6 +1189,7 @@ void QQmlListCompositor::listItemsInserted(
         const QVector<MovedFlags> *movedFlags)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< list << insertions)
+    invalidateIndex();
     for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges; *it = it->next) {
         if (it->list != list || it->flags == CacheFlag) {
             // Skip ranges that don't reference list.
@@ -1078,6 +1313,7 @@ void QQmlListCompositor::listItemsRemoved(
         QVector<MovedFlags> *movedFlags)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< list << *removals)
+    invalidateIndex();
 
     for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges; *it = it->next) {
         if (it->list != list || it->flags == CacheFlag) {
@@ -54,6 +54,7 @@
 //
 
 #include <QtCore/qglobal.h>
+#include <QtCore/qbitarray.h>
 #include <QtCore/qvector.h>
 
 #include <private/qqmlchangeset_p.h>
@@ -134,7 +135,8 @@ public:
         Range *operator ->() { return range; }
         const Range *operator ->() const { return range; }
 
-        iterator &operator +=(int difference);
+        iterator &operator +=(int difference) { advance(difference); return *this; }
+        int advance(int difference);
 
         template<typename T> T *list() const { return static_cast<T *>(range->list); }
         int modelIndex() const { return range->index + offset; }
@@ -242,6 +244,9 @@ public:
     void clearFlags(iterator from, int count, uint flags, QVector<Remove> *removals = 0) {
         clearFlags(from, count, from.group, flags, removals); }
 
+    void setListFlags(void *list, const QBitArray &indexes, uint flags, QVector<Insert> *inserts = 0);
+    void clearListFlags(void *list, const QBitArray &indexes, uint flags, QVector<Remove> *removes = 0);
+
     bool verifyMoveTo(Group fromGroup, int from, Group toGroup, int to, int count, Group group) const;
 
     void move(
@@ -275,9 +280,33 @@ private:
     int m_removeFlags;
     int m_moveId;
 
+    struct IndexEntry
+    {
+        Range *range;
+        int index[MaximumGroupCount];
+    };
+
+    enum { IndexInterval = 16 };
+
+    QVector<IndexEntry> m_index;
+    int m_rangeCount;
+    int m_walkedRanges;
+    bool m_indexValid;
+
     inline Range *insert(Range *before, void *list, int index, int count, uint flags);
     inline Range *erase(Range *range);
 
+    void invalidateIndex() { m_indexValid = false; m_walkedRanges = 0; }
+    void updateListFlags(
+            void *list,
+            const QBitArray &indexes,
+            uint flags,
+            bool set,
+            QVector<Insert> *inserts,
+            QVector<Remove> *removes);
+    void buildIndex();
+    iterator findIndexed(Group group, int index) const;
+
     struct MovedFlags
     {
         MovedFlags() {}
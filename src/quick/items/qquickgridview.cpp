@@ -1535,6 +1535,25 @@ void QQuickGridView::setHighlightFollowsCurrentItem(bool autoHighlight)
     delegates; the fewer objects and bindings in a delegate, the faster a view may be
     scrolled.
 */
+
+/*!
+    \qmlproperty bool QtQuick::GridView::reuseItems
+    \since 5.2
+
+    This property holds whether delegate instances are reused rather than destroyed
+    when they are moved out of the view and cacheBuffer.
+
+    If true a delegate instance that is no longer needed is kept and bound to the next
+    item that is scrolled into view, which avoids creating a new instance.  This can
+    make flicking through long lists noticeably smoother.  Any state of a delegate that
+    isn't bound to the model data or index is kept when it is reused, and can be reset
+    in the DelegateModel.onReused attached signal handler.
+
+    This property only applies if the view creates its own DelegateModel, use
+    DelegateModel::reuseItems when the model is a DelegateModel.
+
+    The default value is false.
+*/
 void QQuickGridView::setHighlightMoveDuration(int duration)
 {
     Q_D(QQuickGridView);
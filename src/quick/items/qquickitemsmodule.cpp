@@ -267,6 +267,9 @@ static void qt_quickitems_defineModule(const char *uri, int major, int minor)
 
     qmlRegisterType<QQuickText, 2>(uri, 2, 2, "Text");
     qmlRegisterType<QQuickTextEdit, 2>(uri, 2, 2, "TextEdit");
+    qmlRegisterUncreatableType<QQuickItemView, 2>(uri, 2, 2, "ItemView", QQuickItemView::tr("ItemView is an abstract base class"));
+    qmlRegisterType<QQuickListView, 2>(uri, 2, 2, "ListView");
+    qmlRegisterType<QQuickGridView, 2>(uri, 2, 2, "GridView");
 }
 
 static void initResources()
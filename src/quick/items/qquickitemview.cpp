@@ -306,7 +306,9 @@ void QQuickItemView::setModel(const QVariant &model)
         d->model = vim;
     } else {
         if (!d->ownModel) {
-            d->model = new QQmlDelegateModel(qmlContext(this), this);
+            QQmlDelegateModel *dataModel = new QQmlDelegateModel(qmlContext(this), this);
+            dataModel->setReuseItems(d->reuseItems);
+            d->model = dataModel;
             d->ownModel = true;
             if (isComponentComplete())
                 static_cast<QQmlDelegateModel *>(d->model.data())->componentComplete();
@@ -359,7 +361,9 @@ void QQuickItemView::setDelegate(QQmlComponent *delegate)
     if (delegate == this->delegate())
         return;
     if (!d->ownModel) {
-        d->model = new QQmlDelegateModel(qmlContext(this));
+        QQmlDelegateModel *dataModel = new QQmlDelegateModel(qmlContext(this));
+        dataModel->setReuseItems(d->reuseItems);
+        d->model = dataModel;
         d->ownModel = true;
     }
     if (QQmlDelegateModel *dataModel = qobject_cast<QQmlDelegateModel*>(d->model)) {
@@ -459,6 +463,25 @@ void QQuickItemView::setCacheBuffer(int b)
     }
 }
 
+bool QQuickItemView::reuseItems() const
+{
+    Q_D(const QQuickItemView);
+    return d->reuseItems;
+}
+
+void QQuickItemView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickItemView);
+    if (d->reuseItems != reuse) {
+        d->reuseItems = reuse;
+        if (d->ownModel) {
+            if (QQmlDelegateModel *dataModel = qobject_cast<QQmlDelegateModel *>(d->model))
+                dataModel->setReuseItems(reuse);
+        }
+        emit reuseItemsChanged();
+    }
+}
+
 
 Qt::LayoutDirection QQuickItemView::layoutDirection() const
 {
@@ -1459,7 +1482,7 @@ QQuickItemViewPrivate::QQuickItemViewPrivate()
     , inLayout(false), inViewportMoved(false), forceLayout(false), currentIndexCleared(false)
     , haveHighlightRange(false), autoHighlight(true), highlightRangeStartValid(false), highlightRangeEndValid(false)
     , fillCacheBuffer(false), inRequest(false)
-    , runDelayedRemoveTransition(false), delegateValidated(false)
+    , runDelayedRemoveTransition(false), delegateValidated(false), reuseItems(false)
 {
     bufferPause.addAnimationChangeListener(this, QAbstractAnimationJob::Completion);
     bufferPause.setLoopCount(1);
@@ -2232,6 +2255,8 @@ FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, bool asynchronous)
         return 0;
     } else {
         item->setParentItem(q->contentItem());
+        if (pooledItems.remove(item))
+            item->setVisible(true);
         if (requestedIndex == modelIndex)
             requestedIndex = -1;
         FxViewItem *viewItem = newViewItem(modelIndex, item);
@@ -2283,6 +2308,7 @@ void QQuickItemView::destroyingItem(QObject *object)
     if (item) {
         item->setParentItem(0);
         d->unrequestedItems.remove(item);
+        d->pooledItems.remove(item);
     }
 }
 
@@ -2300,6 +2326,14 @@ bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
         // item was not destroyed, and we no longer reference it.
         QQuickItemPrivate::get(item->item)->setCulled(true);
         unrequestedItems.insert(item->item, model->indexOf(item->item, q));
+    } else if (flags & QQmlInstanceModel::Pooled) {
+        // item will be reused, keep it parented so its bindings stay valid but hide it.
+        QQuickItemPrivate *itemPrivate = QQuickItemPrivate::get(item->item);
+        itemPrivate->setCulled(true);
+        if (itemPrivate->explicitVisible) {
+            item->item->setVisible(false);
+            pooledItems.insert(item->item);
+        }
     } else if (flags & QQmlInstanceModel::Destroyed) {
         item->item->setParentItem(0);
     }
@@ -63,6 +63,7 @@ class Q_AUTOTEST_EXPORT QQuickItemView : public QQuickFlickable
 
     Q_PROPERTY(bool keyNavigationWraps READ isWrapEnabled WRITE setWrapEnabled NOTIFY keyNavigationWrapsChanged)
     Q_PROPERTY(int cacheBuffer READ cacheBuffer WRITE setCacheBuffer NOTIFY cacheBufferChanged)
+    Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged REVISION 2)
 
     Q_PROPERTY(Qt::LayoutDirection layoutDirection READ layoutDirection WRITE setLayoutDirection NOTIFY layoutDirectionChanged)
     Q_PROPERTY(Qt::LayoutDirection effectiveLayoutDirection READ effectiveLayoutDirection NOTIFY effectiveLayoutDirectionChanged)
@@ -133,6 +134,9 @@ public:
     int cacheBuffer() const;
     void setCacheBuffer(int);
 
+    bool reuseItems() const;
+    void setReuseItems(bool);
+
     Qt::LayoutDirection layoutDirection() const;
     void setLayoutDirection(Qt::LayoutDirection);
     Qt::LayoutDirection effectiveLayoutDirection() const;
@@ -218,6 +222,7 @@ Q_SIGNALS:
 
     void keyNavigationWrapsChanged();
     void cacheBufferChanged();
+    Q_REVISION(2) void reuseItemsChanged();
 
     void layoutDirectionChanged();
     void effectiveLayoutDirectionChanged();
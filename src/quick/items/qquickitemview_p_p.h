@@ -48,6 +48,7 @@
 #include <QtQml/private/qqmlobjectmodel_p.h>
 #include <QtQml/private/qqmldelegatemodel_p.h>
 #include <QtQml/private/qqmlchangeset_p.h>
+#include <QtCore/qset.h>
 
 
 QT_BEGIN_NAMESPACE
@@ -267,6 +268,7 @@ public:
     FxViewItem *currentItem;
     FxViewItem *trackedItem;
     QHash<QQuickItem*,int> unrequestedItems;
+    QSet<QQuickItem*> pooledItems;
     int requestedIndex;
     QQuickItemViewChangeSet currentChanges;
     QQuickItemViewChangeSet bufferedChanges;
@@ -310,6 +312,7 @@ public:
     bool inRequest : 1;
     bool runDelayedRemoveTransition : 1;
     bool delegateValidated : 1;
+    bool reuseItems : 1;
 
 protected:
     virtual Qt::Orientation layoutOrientation() const = 0;
@@ -164,6 +164,8 @@ QQuickItem *QQuickPathViewPrivate::getItem(int modelIndex, qreal z, bool async)
         }
     } else {
         item->setParentItem(q);
+        if (pooledItems.remove(item))
+            item->setVisible(true);
         requestedIndex = -1;
         QQuickItemPrivate *itemPrivate = QQuickItemPrivate::get(item);
         itemPrivate->addItemChangeListener(this, QQuickItemPrivate::Geometry);
@@ -227,6 +229,15 @@ void QQuickPathViewPrivate::releaseItem(QQuickItem *item)
         // item was not destroyed, and we no longer reference it.
         if (QQuickPathViewAttached *att = attached(item))
             att->setOnPath(false);
+    } else if (flags & QQmlInstanceModel::Pooled) {
+        // item will be reused, keep it parented so its bindings stay valid but hide it.
+        if (QQuickPathViewAttached *att = attached(item))
+            att->setOnPath(false);
+        itemPrivate->setCulled(true);
+        if (itemPrivate->explicitVisible) {
+            item->setVisible(false);
+            pooledItems.insert(item);
+        }
     } else if (flags & QQmlInstanceModel::Destroyed) {
         // but we still reference it
         item->setParentItem(0);
@@ -642,6 +653,8 @@ void QQuickPathView::setModel(const QVariant &model)
                              this, QQuickPathView, SLOT(createdItem(int,QObject*)));
         qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(initItem(int,QObject*)),
                              this, QQuickPathView, SLOT(initItem(int,QObject*)));
+        qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(destroyingItem(QObject*)),
+                             this, QQuickPathView, SLOT(destroyingItem(QObject*)));
         d->clear();
     }
 
@@ -673,6 +686,8 @@ void QQuickPathView::setModel(const QVariant &model)
                           this, QQuickPathView, SLOT(createdItem(int,QObject*)));
         qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(initItem(int,QObject*)),
                           this, QQuickPathView, SLOT(initItem(int,QObject*)));
+        qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(destroyingItem(QObject*)),
+                          this, QQuickPathView, SLOT(destroyingItem(QObject*)));
         d->modelCount = d->model->count();
     }
     if (isComponentComplete()) {
@@ -2112,9 +2127,11 @@ void QQuickPathView::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
         emit countChanged();
 }
 
-void QQuickPathView::destroyingItem(QObject *item)
+void QQuickPathView::destroyingItem(QObject *object)
 {
-    Q_UNUSED(item);
+    Q_D(QQuickPathView);
+    if (QQuickItem *item = qmlobject_cast<QQuickItem*>(object))
+        d->pooledItems.remove(item);
 }
 
 void QQuickPathView::ticked()
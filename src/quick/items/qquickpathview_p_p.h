@@ -59,6 +59,7 @@
 #include <QtQml/qqml.h>
 #include <QtCore/qdatetime.h>
 #include <QtCore/qcoreapplication.h>
+#include <QtCore/qset.h>
 
 #include <private/qquickanimation_p_p.h>
 #include <private/qqmldelegatemodel_p.h>
@@ -168,6 +169,7 @@ public:
     qreal requestedZ;
     QList<QQuickItem *> items;
     QList<QQuickItem *> itemCache;
+    QSet<QQuickItem *> pooledItems;
     QPointer<QQmlInstanceModel> model;
     QVariant modelVariant;
     enum MovementReason { Other, SetIndex, Mouse };
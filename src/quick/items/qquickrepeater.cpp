@@ -199,7 +199,7 @@ void QQuickRepeater::setModel(const QVariant &model)
                 this, SLOT(modelUpdated(QQmlChangeSet,bool)));
         disconnect(d->model, SIGNAL(createdItem(int,QObject*)), this, SLOT(createdItem(int,QObject*)));
         disconnect(d->model, SIGNAL(initItem(int,QObject*)), this, SLOT(initItem(int,QObject*)));
-//        disconnect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
+        disconnect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
     }
     d->dataSource = model;
     QObject *object = qvariant_cast<QObject*>(model);
@@ -227,7 +227,7 @@ void QQuickRepeater::setModel(const QVariant &model)
                 this, SLOT(modelUpdated(QQmlChangeSet,bool)));
         connect(d->model, SIGNAL(createdItem(int,QObject*)), this, SLOT(createdItem(int,QObject*)));
         connect(d->model, SIGNAL(initItem(int,QObject*)), this, SLOT(initItem(int,QObject*)));
-//        connect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
+        connect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
         regenerate();
     }
     emit modelChanged();
@@ -354,8 +354,7 @@ void QQuickRepeater::clear()
             if (QQuickItem *item = d->deletables.at(i)) {
                 if (complete)
                     emit itemRemoved(i, item);
-                item->setParentItem(0);
-                d->model->release(item);
+                d->releaseItem(item);
             }
         }
     }
@@ -404,6 +403,8 @@ void QQuickRepeaterPrivate::createItems()
             }
             deletables[ii] = item;
             item->setParentItem(q->parentItem());
+            if (pooledItems.remove(item))
+                item->setVisible(true);
             if (ii > 0 && deletables.at(ii-1)) {
                 item->stackAfter(deletables.at(ii-1));
             } else {
@@ -422,6 +423,19 @@ void QQuickRepeaterPrivate::createItems()
     inRequest = false;
 }
 
+void QQuickRepeaterPrivate::releaseItem(QQuickItem *item)
+{
+    if (model->release(item) & QQmlInstanceModel::Pooled) {
+        // item will be reused, keep it parented so its bindings stay valid but hide it.
+        if (QQuickItemPrivate::get(item)->explicitVisible) {
+            item->setVisible(false);
+            pooledItems.insert(item);
+        }
+    } else {
+        item->setParentItem(0);
+    }
+}
+
 void QQuickRepeater::createdItem(int, QObject *)
 {
     Q_D(QQuickRepeater);
@@ -436,6 +450,13 @@ void QQuickRepeater::initItem(int, QObject *object)
         item->setParentItem(parentItem());
 }
 
+void QQuickRepeater::destroyingItem(QObject *object)
+{
+    Q_D(QQuickRepeater);
+    if (QQuickItem *item = qmlobject_cast<QQuickItem*>(object))
+        d->pooledItems.remove(item);
+}
+
 void QQuickRepeater::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
 {
     Q_D(QQuickRepeater);
@@ -464,10 +485,8 @@ void QQuickRepeater::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
             QQuickItem *item = d->deletables.at(index);
             d->deletables.remove(index);
             emit itemRemoved(index, item);
-            if (item) {
-                item->setParentItem(0);
-                d->model->release(item);
-            }
+            if (item)
+                d->releaseItem(item);
             --d->itemCount;
         }
 
@@ -91,6 +91,7 @@ protected:
 private Q_SLOTS:
     void createdItem(int index, QObject *item);
     void initItem(int, QObject *item);
+    void destroyingItem(QObject *item);
     void modelUpdated(const QQmlChangeSet &changeSet, bool reset);
 
 private:
@@ -57,6 +57,7 @@
 #include "qquickitem_p.h"
 
 #include <QtCore/qpointer.h>
+#include <QtCore/qset.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -72,6 +73,7 @@ public:
 
 private:
     void createItems();
+    void releaseItem(QQuickItem *item);
 
     QPointer<QQmlInstanceModel> model;
     QVariant dataSource;
@@ -84,6 +86,7 @@ private:
     int createFrom;
 
     QVector<QPointer<QQuickItem> > deletables;
+    QSet<QQuickItem *> pooledItems;
 };
 
 QT_END_NAMESPACE
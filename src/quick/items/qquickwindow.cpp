@@ -63,6 +63,7 @@
 #include <QtGui/qmatrix4x4.h>
 #include <QtGui/qstylehints.h>
 #include <QtCore/qvarlengtharray.h>
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qabstractanimation.h>
 #include <QtQml/qqmlincubator.h>
 
@@ -90,13 +91,15 @@ void QQuickWindowPrivate::updateFocusItemTransform()
 #endif
 }
 
+static bool qsg_incubation_timing = !qgetenv("QSG_INCUBATION_TIMING").isEmpty();
+
 class QQuickWindowIncubationController : public QObject, public QQmlIncubationController
 {
     Q_OBJECT
 
 public:
     QQuickWindowIncubationController(QSGRenderLoop *loop)
-        : m_renderLoop(loop), m_timer(0)
+        : m_renderLoop(loop), m_timer(0), m_missedDeadlines(0)
     {
         // Allow incubation for 1/3 of a frame.
         m_incubation_time = qMax(1, int(1000 / QGuiApplication::primaryScreen()->refreshRate()) / 3);
@@ -124,11 +127,33 @@ protected:
         }
     }
 
+    void incubateWithinFrame() {
+        // Spend what is left of the frame after sync and animations. When the
+        // render loop does not follow the frame clock, fall back to a fixed
+        // slice. At least one object is always incubated so that loading
+        // makes progress even when the frame is already over budget.
+        int budget = m_renderLoop->incubationBudget();
+        if (budget < 0)
+            budget = m_incubation_time;
+
+        QElapsedTimer timer;
+        timer.start();
+        incubateFor(budget);
+        const int spent = int(timer.elapsed());
+
+        if (spent > budget) {
+            ++m_missedDeadlines;
+            if (qsg_incubation_timing)
+                qDebug("QQuickWindow: incubation missed frame deadline: budget=%d ms, spent=%d ms, missed=%d",
+                       budget, spent, m_missedDeadlines);
+        }
+    }
+
 public slots:
     void incubate() {
         if (incubatingObjectCount()) {
             if (m_renderLoop->interleaveIncubation()) {
-                incubateFor(m_incubation_time);
+                incubateWithinFrame();
             } else {
                 incubateFor(m_incubation_time * 2);
                 if (incubatingObjectCount())
@@ -151,6 +176,7 @@ private:
     int m_incubation_time;
     QAnimationDriver *m_animation_driver;
     int m_timer;
+    int m_missedDeadlines;
 };
 
 #include "qquickwindow.moc"
@@ -2824,6 +2850,11 @@ QImage QQuickWindow::grabWindow()
     for this window. QQuickView automatically installs this controller for you,
     otherwise you will need to install it yourself using \l{QQmlEngine::setIncubationController()}.
 
+    While animations are running, the controller spends the time left of each
+    frame after synchronization and animation updates on incubation. Setting
+    the \c QSG_INCUBATION_TIMING environment variable reports frames where
+    incubation overran that budget.
+
     The controller is owned by the window and will be destroyed when the window
     is deleted.
 */
@@ -86,6 +86,10 @@ public:
 
     virtual bool interleaveIncubation() const { return false; }
 
+    // Milliseconds left of the current frame once sync and animations are
+    // done, or -1 when the render loop does not follow the frame clock.
+    virtual int incubationBudget() const { return -1; }
+
 Q_SIGNALS:
     void timeToIncubate();
 
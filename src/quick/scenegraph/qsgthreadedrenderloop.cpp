@@ -743,6 +743,19 @@ bool QSGThreadedRenderLoop::interleaveIncubation() const
     return m_animation_driver->isRunning() && anyoneShowing();
 }
 
+/*
+ * Returns how much of the current frame interval is left on the GUI thread
+ * after polish, sync and the animation tick. The render thread renders and
+ * swaps in parallel, so this is what the GUI thread can spend on incubation
+ * without delaying the next polish and sync.
+ */
+int QSGThreadedRenderLoop::incubationBudget() const
+{
+    if (!m_frame_timer.isValid())
+        return -1;
+    return qMax(0, qsgrl_animation_interval() - int(m_frame_timer.elapsed()));
+}
+
 void QSGThreadedRenderLoop::animationStarted()
 {
     QSG_GUI_DEBUG((void *) 0, "animationStarted()");
@@ -1072,6 +1085,7 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w)
         return;
     }
 
+    m_frame_timer.start();
 
 #ifndef QSG_NO_RENDER_TIMING
     QElapsedTimer timer;
@@ -1155,6 +1169,7 @@ bool QSGThreadedRenderLoop::event(QEvent *e)
         QTimerEvent *te = static_cast<QTimerEvent *>(e);
         if (te->timerId() == m_animation_timer) {
             QSG_GUI_DEBUG((void *) 0, "QEvent::Timer -> non-visual animation");
+            m_frame_timer.start();
             m_animation_driver->advance();
             emit timeToIncubate();
         } else {
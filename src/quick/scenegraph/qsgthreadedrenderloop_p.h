@@ -43,6 +43,7 @@
 #define QSGTHREADEDRENDERLOOP_P_H
 
 #include <QtCore/QThread>
+#include <QtCore/QElapsedTimer>
 #include <QtGui/QOpenGLContext>
 #include <private/qsgcontext_p.h>
 
@@ -79,6 +80,7 @@ public:
     bool event(QEvent *);
 
     bool interleaveIncubation() const;
+    int incubationBudget() const;
 
 public Q_SLOTS:
     void animationStarted();
@@ -118,6 +120,8 @@ private:
     int m_animation_timer;
     int m_exhaust_delay;
 
+    QElapsedTimer m_frame_timer;
+
     bool m_locked;
 };
 
@@ -115,6 +115,22 @@ bool QSGWindowsRenderLoop::interleaveIncubation() const
     return m_animationDriver->isRunning() && anyoneShowing();
 }
 
+/*
+ * The frame timer is started right after the last swap of a render pass,
+ * which is when the frame clock ticks since swapBuffers() blocks on vsync.
+ * When no frame was swapped or the swap lies more than a frame back, the
+ * time left is unknown and the incubation controller uses its fixed slice.
+ */
+int QSGWindowsRenderLoop::incubationBudget() const
+{
+    if (!m_frameTimer.isValid())
+        return -1;
+    const int elapsed = int(m_frameTimer.elapsed());
+    if (elapsed > m_vsyncDelta)
+        return -1;
+    return m_vsyncDelta - elapsed;
+}
+
 QSGWindowsRenderLoop::WindowData *QSGWindowsRenderLoop::windowData(QQuickWindow *window)
 {
     for (int i=0; i<m_windows.size(); ++i) {
@@ -153,6 +169,7 @@ void QSGWindowsRenderLoop::started()
 void QSGWindowsRenderLoop::stopped()
 {
     RLDEBUG("Animations stopped...");
+    m_frameTimer.invalidate();
     if (m_animationTimer) {
         RLDEBUG(" - stopping non-visual animation timer");
         killTimer(m_animationTimer);
@@ -314,6 +331,9 @@ void QSGWindowsRenderLoop::exposureChanged(QQuickWindow *window)
 void QSGWindowsRenderLoop::handleObscurity()
 {
     RLDEBUG("handleObscurity");
+    if (!anyoneShowing())
+        m_frameTimer.invalidate();
+
     // Potentially start the non-visual animation timer if nobody is rendering
     if (m_animationDriver->isRunning() && !anyoneShowing() && !m_animationTimer) {
         RLDEBUG(" - starting non-visual animation timer");
@@ -385,13 +405,19 @@ bool QSGWindowsRenderLoop::event(QEvent *event)
 void QSGWindowsRenderLoop::render()
 {
     RLDEBUG("render");
+    bool swapped = false;
     foreach (const WindowData &wd, m_windows) {
         if (wd.pendingUpdate) {
             const_cast<WindowData &>(wd).pendingUpdate = false;
-            renderWindow(wd.window);
+            swapped |= renderWindow(wd.window);
         }
     }
 
+    if (swapped)
+        m_frameTimer.start();
+    else if (!anyoneShowing())
+        m_frameTimer.invalidate();
+
     if (m_animationDriver->isRunning()) {
         RLDEBUG("advancing animations");
         QSG_RENDER_TIMING_SAMPLE(time_start);
@@ -421,22 +447,22 @@ void QSGWindowsRenderLoop::render()
 
 /*
  * Render the contents of this window. First polish, then sync, render
- * then finally swap.
+ * then finally swap. Returns true if the frame was swapped.
  *
  * Note: This render function does not implement aborting
  * the render call when sync step results in no scene graph changes,
  * like the threaded renderer does.
  */
-void QSGWindowsRenderLoop::renderWindow(QQuickWindow *window)
+bool QSGWindowsRenderLoop::renderWindow(QQuickWindow *window)
 {
     RLDEBUG("renderWindow");
     QQuickWindowPrivate *d = QQuickWindowPrivate::get(window);
 
     if (!d->isRenderable())
-        return;
+        return false;
 
     if (!m_gl->makeCurrent(window))
-        return;
+        return false;
 
     QSG_RENDER_TIMING_SAMPLE(time_start);
 
@@ -483,6 +509,8 @@ void QSGWindowsRenderLoop::renderWindow(QQuickWindow *window)
                         );
         }
 #endif
+
+    return true;
 }
 
 QT_END_NAMESPACE
@@ -79,12 +79,13 @@ public:
     void releaseResources(QQuickWindow *) { }
 
     void render();
-    void renderWindow(QQuickWindow *window);
+    bool renderWindow(QQuickWindow *window);
 
     bool event(QEvent *event);
     bool anyoneShowing() const;
 
     bool interleaveIncubation() const;
+    int incubationBudget() const;
 
 public Q_SLOTS:
     void started();
@@ -112,6 +113,8 @@ private:
     int m_animationTimer;
 
     int m_vsyncDelta;
+
+    QElapsedTimer m_frameTimer;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,8 @@
+import QtQuick 2.0
+
+QtObject {
+    property int calls: 0
+
+    signal fired
+    onFired: { calls++; break; }
+}
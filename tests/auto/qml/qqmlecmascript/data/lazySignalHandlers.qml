@@ -0,0 +1,10 @@
+import QtQuick 2.0
+
+QtObject {
+    property int base: 0
+    property int total: 0
+    property int calls: 0
+
+    signal fired(int amount)
+    onFired: { total = base + amount; calls++ }
+}
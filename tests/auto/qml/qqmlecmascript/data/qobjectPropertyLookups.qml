@@ -0,0 +1,56 @@
+import QtQuick 2.0
+import Qt.test 1.0
+
+MyQmlObject {
+    id: root
+
+    property bool success: false
+
+    property QtObject first: QtObject {
+        property int count: 1
+        property real ratio: 0.5
+        property bool flag: true
+    }
+    property QtObject second: QtObject {
+        property string label: "second"
+        property int count: 2
+        property real ratio: 1.5
+        property bool flag: false
+    }
+
+    function sumCounts(objects) {
+        var total = 0;
+        for (var i = 0; i < objects.length; ++i)
+            total += objects[i].count;
+        return total;
+    }
+
+    Component.onCompleted: {
+        var objects = [first, second, first, second];
+        for (var i = 0; i < 10; ++i) {
+            if (sumCounts(objects) != 6)
+                return;
+        }
+
+        for (var i = 0; i < objects.length; ++i) {
+            var o = objects[i];
+            o.flag = !o.flag;
+            o.ratio = o.ratio * 2;
+        }
+        if (first.flag != true || second.flag != false)
+            return;
+        if (first.ratio != 2 || second.ratio != 6)
+            return;
+
+        for (var i = 0; i < 10; ++i)
+            root.intProperty = root.intProperty + 1;
+        if (root.intProperty != 10 || root.trueProperty !== true)
+            return;
+
+        objects.push({ count: 4 });
+        if (sumCounts(objects) != 10)
+            return;
+
+        success = true;
+    }
+}
@@ -55,6 +55,7 @@
 #include "../../shared/util.h"
 #include <private/qv4functionobject_p.h>
 #include <private/qv4scopedvalue_p.h>
+#include <private/qv4identifiertable_p.h>
 
 #ifdef Q_CC_MSVC
 #define NO_INLINE __declspec(noinline)
@@ -261,6 +262,10 @@ private slots:
     void include();
     void includeRemoteSuccess();
     void signalHandlers();
+    void lazySignalHandlers();
+    void lazySignalHandlerError();
+    void signalHandlerCompileError();
+    void preinternedIdentifiers();
     void doubleEvaluate();
     void forInLoop();
     void nonNotifyable();
@@ -319,6 +324,7 @@ private slots:
     void stackLimits();
     void idsAsLValues();
     void qtbug_34792();
+    void qobjectPropertyLookups();
 
 private:
 //    static void propertyVarWeakRefCallback(v8::Persistent<v8::Value> object, void* parameter);
@@ -6063,6 +6069,119 @@ void tst_qqmlecmascript::signalHandlers()
     delete o;
 }
 
+void tst_qqmlecmascript::lazySignalHandlers()
+{
+    // The handler is compiled on its first emission and shared by every instance,
+    // each of which must still run it in its own scope.
+    EnvironmentVariableGuard lazy("QML_LAZY_SIGNAL_HANDLERS", "1");
+    QQmlComponent component(&engine, testFileUrl("lazySignalHandlers.qml"));
+    QList<QObject *> objects;
+    for (int ii = 0; ii < 3; ++ii) {
+        QObject *o = component.create();
+        QVERIFY(o != 0);
+        o->setProperty("base", ii * 10);
+        objects.append(o);
+    }
+
+    for (int round = 1; round <= 2; ++round) {
+        for (int ii = 0; ii < objects.count(); ++ii) {
+            QVERIFY(QMetaObject::invokeMethod(objects.at(ii), "fired", Q_ARG(int, round)));
+            QCOMPARE(objects.at(ii)->property("total").toInt(), ii * 10 + round);
+            QCOMPARE(objects.at(ii)->property("calls").toInt(), round);
+        }
+    }
+
+    // Instances created after the handler was compiled use the same function.
+    QObject *late = component.create();
+    QVERIFY(late != 0);
+    late->setProperty("base", 100);
+    QVERIFY(QMetaObject::invokeMethod(late, "fired", Q_ARG(int, 5)));
+    QCOMPARE(late->property("total").toInt(), 105);
+    objects.append(late);
+
+    qDeleteAll(objects);
+}
+
+static QStringList qqmlecmascript_warnings;
+static void qqmlecmascript_warningsHandler(QtMsgType type, const QMessageLogContext &, const QString &msg)
+{
+    if (type == QtWarningMsg)
+        qqmlecmascript_warnings.append(msg);
+}
+
+void tst_qqmlecmascript::lazySignalHandlerError()
+{
+    // A handler that fails to compile is reported once, not by every instance.
+    EnvironmentVariableGuard lazy("QML_LAZY_SIGNAL_HANDLERS", "1");
+    QQmlComponent component(&engine, testFileUrl("lazySignalHandlerError.qml"));
+    QList<QObject *> objects;
+    for (int ii = 0; ii < 3; ++ii) {
+        QObject *o = component.create();
+        QVERIFY(o != 0);
+        objects.append(o);
+    }
+
+    qqmlecmascript_warnings.clear();
+    QtMessageHandler previousMsgHandler = qInstallMessageHandler(qqmlecmascript_warningsHandler);
+    for (int ii = 0; ii < objects.count(); ++ii) {
+        QVERIFY(QMetaObject::invokeMethod(objects.at(ii), "fired"));
+        QVERIFY(QMetaObject::invokeMethod(objects.at(ii), "fired"));
+    }
+    qInstallMessageHandler(previousMsgHandler);
+
+    QCOMPARE(qqmlecmascript_warnings.count(), 1);
+    QVERIFY(qqmlecmascript_warnings.first().startsWith(testFileUrl("lazySignalHandlerError.qml").toString()));
+    QVERIFY(qqmlecmascript_warnings.first().contains(QLatin1String("Break outside of loop")));
+    for (int ii = 0; ii < objects.count(); ++ii)
+        QCOMPARE(objects.at(ii)->property("calls").toInt(), 0);
+
+    qDeleteAll(objects);
+}
+
+void tst_qqmlecmascript::signalHandlerCompileError()
+{
+    // By default signal handlers are compiled with the component, so errors in them
+    // make the component fail to compile.
+    EnvironmentVariableGuard lazy("QML_LAZY_SIGNAL_HANDLERS", "0");
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("lazySignalHandlerError.qml"));
+    QVERIFY(component.isError());
+    QVERIFY(component.errorString().contains(QLatin1String("Break outside of loop")));
+}
+
+void tst_qqmlecmascript::preinternedIdentifiers()
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    file.write("preinternedFirst\n  \npreinternedSecond\n");
+    file.close();
+
+    EnvironmentVariableGuard identifiers("QV4_PREINTERN_IDENTIFIERS", QFile::encodeName(file.fileName()));
+    QQmlEngine engine;
+    QV4::ExecutionEngine *v4 = QV8Engine::getV4(&engine);
+    QV4::IdentifierTable *table = v4->identifierTable;
+
+    // Looking the names up finds the pre-interned strings instead of adding new ones,
+    // whether they come from a QString or from a compilation unit's string table.
+    const int size = table->size;
+    const QString first = QStringLiteral("preinternedFirst");
+    QV4::String *interned = v4->newIdentifier(first);
+    QCOMPARE(table->size, size);
+    QCOMPARE(table->insertString(first.constData(), first.length(),
+                                 QV4::String::createHashValue(first.constData(), first.length())),
+             interned);
+    QVERIFY(interned->identifier);
+    QCOMPARE(table->identifier(first), interned->identifier);
+
+    QCOMPARE(v4->newIdentifier(QStringLiteral("preinternedSecond"))->toQString(),
+             QStringLiteral("preinternedSecond"));
+    QCOMPARE(table->size, size);
+
+    // Other names are still added
+    v4->newIdentifier(QStringLiteral("notPreinterned"));
+    QCOMPARE(table->size, size + 1);
+}
+
 void tst_qqmlecmascript::qtbug_10696()
 {
     QQmlComponent component(&engine, testFileUrl("qtbug_10696.qml"));
@@ -7491,6 +7610,18 @@ void tst_qqmlecmascript::qtbug_34792()
     delete object;
 }
 
+void tst_qqmlecmascript::qobjectPropertyLookups()
+{
+    QQmlComponent component(&engine, testFileUrl("qobjectPropertyLookups.qml"));
+
+    QObject *object = component.create();
+    if (object == 0)
+        qDebug() << component.errorString();
+    QVERIFY(object != 0);
+    QVERIFY(object->property("success").toBool());
+    delete object;
+}
+
 QTEST_MAIN(tst_qqmlecmascript)
 
 #include "tst_qqmlecmascript.moc"
@@ -82,6 +82,7 @@ private slots:
     void qtqmlModule();
     void urlInterceptor_data();
     void urlInterceptor();
+    void dataStatistics();
 
 public slots:
     QObject *createAQObjectForOwnershipTest ()
@@ -785,6 +786,45 @@ void tst_qqmlengine::urlInterceptor()
     QCOMPARE(o->property("absoluteUrl").toString(), expectedAbsoluteUrl);
 }
 
+void tst_qqmlengine::dataStatistics()
+{
+    QScopedPointer<QObject> object;
+    QQmlTestMessageHandler messageHandler;
+    {
+        EnvironmentVariableGuard statistics("QML_DATA_STATISTICS", "1");
+        QQmlEngine engine;
+        QQmlComponent component(&engine);
+        component.setData("import QtQml 2.0\n"
+                          "QtObject {\n"
+                          "    property QtObject a: QtObject { property int value: 1 }\n"
+                          "    property QtObject b: QtObject { property int value: a.value }\n"
+                          "}", QUrl());
+        object.reset(component.create());
+        QVERIFY(object);
+        messageHandler.clear();
+    }
+
+    // The objects are still alive but were counted when they were created.
+    QVERIFY(messageHandler.messages().count() > 0);
+    QVERIFY(messageHandler.messages().first().startsWith(QLatin1String("QQmlData statistics")));
+    const QString total = messageHandler.messages().last().trimmed();
+    QVERIFY2(total.startsWith(QLatin1String("total: objects=")), qPrintable(total));
+    QVERIFY2(total.section(QLatin1Char('='), 1, 1).section(QLatin1Char(' '), 0, 0).toInt() >= 3,
+             qPrintable(total));
+    QVERIFY(!messageHandler.messageString().contains(QLatin1String("notifyLists=0 ")));
+
+    // Nothing is recorded, or reported again, for engines without the variable.
+    messageHandler.clear();
+    {
+        QQmlEngine engine;
+        QQmlComponent component(&engine);
+        component.setData("import QtQml 2.0\nQtObject {}", QUrl());
+        QScopedPointer<QObject> other(component.create());
+        QVERIFY(other);
+    }
+    QVERIFY2(messageHandler.messages().isEmpty(), qPrintable(messageHandler.messageString()));
+}
+
 QTEST_MAIN(tst_qqmlengine)
 
 #include "tst_qqmlengine.moc"
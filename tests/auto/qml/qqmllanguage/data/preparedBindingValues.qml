@@ -0,0 +1,23 @@
+import Test 1.0
+
+MyTypeObject {
+    colorProperty: "red"
+    dateProperty: "1982-11-25"
+    timeProperty: "11:11:32"
+    dateTimeProperty: "2009-05-12T13:22:01"
+    pointProperty: "99,13"
+    pointFProperty: "-10.1,12.3"
+    sizeProperty: "99x13"
+    sizeFProperty: "0.1x0.2"
+    rectProperty: "9,7,100x200"
+    rectFProperty: "1000.1,-10.9,400x90.99"
+    vectorProperty: "10,1,2.2"
+    vector4Property: "10,1,2.2,2.3"
+    stringProperty: child.stringProperty
+
+    objectProperty: MyTypeObject {
+        id: child
+        colorProperty: "#00ff00"
+        stringProperty: "child"
+    }
+}
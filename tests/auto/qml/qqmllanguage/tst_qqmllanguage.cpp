@@ -56,6 +56,9 @@
 #include <private/qqmlmetatype_p.h>
 #include <private/qqmlglobal_p.h>
 #include <private/qqmlscriptstring_p.h>
+#include <private/qqmlcomponent_p.h>
+#include <private/qqmlcompiler_p.h>
+#include <private/qqmlengine_p.h>
 
 #include "testtypes.h"
 #include "testhttpserver.h"
@@ -93,6 +96,7 @@ private slots:
     void assignLiteralSignalProperty();
     void assignQmlComponent();
     void assignBasicTypes();
+    void preparedBindingValues();
     void assignTypeExtremes();
     void assignCompositeToType();
     void assignLiteralToVariant();
@@ -655,6 +659,47 @@ void tst_qqmllanguage::assignBasicTypes()
     QCOMPARE(object->property("mirroredEnumTriggeredChange").toBool(), false);
 }
 
+// Test that literals prepared when the component is compiled are assigned
+// correctly to every object created from it
+void tst_qqmllanguage::preparedBindingValues()
+{
+    QQmlEngine engine;
+    QQmlEnginePrivate::get(&engine)->useNewCompiler = true;
+
+    QQmlComponent component(&engine, testFileUrl("preparedBindingValues.qml"));
+    VERIFY_ERRORS(0);
+
+    QQmlCompiledData *cc = QQmlComponentPrivate::get(&component)->cc;
+    QVERIFY(cc);
+    QCOMPARE(cc->preparedBindingValues.count(), 13);
+    QCOMPARE(cc->idMappingsForRoot.count(), 1);
+    QCOMPARE(cc->idMappingsForRoot.first().name, QString("child"));
+
+    for (int i = 0; i < 2; ++i) {
+        QScopedPointer<MyTypeObject> object(qobject_cast<MyTypeObject *>(component.create()));
+        QVERIFY(object);
+        QCOMPARE(object->colorProperty(), QColor("red"));
+        QCOMPARE(object->dateProperty(), QDate(1982, 11, 25));
+        QCOMPARE(object->timeProperty(), QTime(11, 11, 32));
+        QCOMPARE(object->dateTimeProperty(), QDateTime(QDate(2009, 5, 12), QTime(13, 22, 1)));
+        QCOMPARE(object->pointProperty(), QPoint(99,13));
+        QCOMPARE(object->pointFProperty(), QPointF(-10.1, 12.3));
+        QCOMPARE(object->sizeProperty(), QSize(99, 13));
+        QCOMPARE(object->sizeFProperty(), QSizeF(0.1, 0.2));
+        QCOMPARE(object->rectProperty(), QRect(9, 7, 100, 200));
+        QCOMPARE(object->rectFProperty(), QRectF(1000.1, -10.9, 400, 90.99));
+        QCOMPARE(object->vectorProperty(), QVector3D(10, 1, 2.2f));
+        QCOMPARE(object->vector4Property(), QVector4D(10, 1, 2.2f, 2.3f));
+
+        // The id table is prepared as well
+        QCOMPARE(object->stringProperty(), QString("child"));
+        MyTypeObject *child = qobject_cast<MyTypeObject *>(object->objectProperty());
+        QVERIFY(child != 0);
+        QCOMPARE(child->colorProperty(), QColor(0, 255, 0));
+        QCOMPARE(qmlContext(child)->contextProperty("child").value<QObject *>(), static_cast<QObject *>(child));
+    }
+}
+
 // Test edge case type assignments
 void tst_qqmllanguage::assignTypeExtremes()
 {
@@ -152,6 +152,7 @@ private slots:
     void find();
     void findInsertPosition_data();
     void findInsertPosition();
+    void findManyRanges();
     void insert();
     void clearFlags_data();
     void clearFlags();
@@ -294,6 +295,55 @@ void tst_qqmllistcompositor::findInsertPosition()
     QCOMPARE(it->index, rangeIndex);
 }
 
+void tst_qqmllistcompositor::findManyRanges()
+{
+    int listA; void *a = &listA;
+
+    QQmlListCompositor compositor;
+    compositor.setGroupCount(4);
+    compositor.append(a, 0, 1000, C::PrependFlag | C::DefaultFlag);
+
+    // Put every other item in the selection so each item is its own range.
+    for (int i = 0; i < 1000; i += 2)
+        compositor.setFlags(C::Default, i, 1, SelectionFlag);
+    QCOMPARE(compositor.count(Selection), 500);
+
+    // Scattered lookups, repeated so the range index gets built and used.
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 500; ++i) {
+            const int index = (i * 127) % 500;
+            C::iterator it = compositor.find(Selection, index);
+            QCOMPARE(it.index[Selection], index);
+            QCOMPARE(it.index[C::Default], 2 * index);
+            QCOMPARE(it.modelIndex(), 2 * index);
+
+            const int defaultIndex = (i * 7) % 1000;
+            it = compositor.find(C::Default, defaultIndex);
+            QCOMPARE(it.index[C::Default], defaultIndex);
+            QCOMPARE(it.index[Selection], (defaultIndex + 1) / 2);
+            QCOMPARE(it.modelIndex(), defaultIndex);
+        }
+    }
+
+    C::insert_iterator it = compositor.findInsertPosition(Selection, 500);
+    QCOMPARE(it.index[Selection], 500);
+    QCOMPARE(it.index[C::Default], 1000);
+
+    // Changes to the ranges must not leave stale positions behind.
+    compositor.clearFlags(C::Default, 500, 1, SelectionFlag);
+    QCOMPARE(compositor.count(Selection), 499);
+    for (int i = 0; i < 499; ++i) {
+        const int index = (i * 127) % 499;
+        C::iterator it = compositor.find(Selection, index);
+        QCOMPARE(it.index[C::Default], index < 250 ? 2 * index : 2 * index + 2);
+    }
+
+    compositor.setFlags(C::Default, 501, 1, SelectionFlag);
+    QCOMPARE(compositor.count(Selection), 500);
+    it = compositor.findInsertPosition(Selection, 250);
+    QCOMPARE(it.index[C::Default], 501);
+}
+
 void tst_qqmllistcompositor::insert()
 {
     QQmlListCompositor compositor;
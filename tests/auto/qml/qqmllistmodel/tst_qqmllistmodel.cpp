@@ -452,6 +452,8 @@ void tst_qqmllistmodel::dynamic_data()
         QTest::newRow("insert5a") << "{insert(0,123)}" << 0 << "<Unknown File>: QML ListModel: insert: value is not an object" << dr;
         QTest::newRow("insert5b") << "{insert(0,[{'foo':11},{'foo':22},{'foo':33}]);count}" << 3 << "" << dr;
         QTest::newRow("insert5c") << "{insert(0,[{'foo':11},{'foo':22},{'foo':33}]);get(2).foo}" << 33 << "" << dr;
+        QTest::newRow("insert5d") << "{append([{'foo':1},{'foo':2}]);insert(1,[{'foo':11},{'foo':22},{'foo':33}]);get(3).foo}" << 22 << "" << dr;
+        QTest::newRow("insert5e") << "{append([{'foo':1},{'foo':2}]);insert(1,[{'foo':11},{'foo':22},{'foo':33}]);get(4).foo}" << 2 << "" << dr;
 
         QTest::newRow("set1") << "{append({'foo':123});set(0,{'foo':456});count}" << 1 << "" << dr;
         QTest::newRow("set2") << "{append({'foo':123});set(0,{'foo':456});get(0).foo}" << 456 << "" << dr;
@@ -1028,6 +1030,14 @@ void tst_qqmllistmodel::property_changes_data()
                 << "{append({'a':123, 'b':456, 'c':789}); get(0); insert(0, {'a':0, 'b':0, 'c':0});}"
                 << "get(1).a = 456;"
                 << "a" << 1 << true << "get(1).a == 456" << dr;
+        QTest::newRow("set: bulk inserted items")
+                << "{append({'a':123, 'b':456, 'c':789}); get(0); insert(0, [{'a':0, 'b':0, 'c':0}, {'a':1, 'b':1, 'c':1}]);}"
+                << "set(2, {'a':456});"
+                << "a" << 2 << true << "get(2).a == 456" << dr;
+        QTest::newRow("get: bulk inserted items")
+                << "{append({'a':123, 'b':456, 'c':789}); get(0); insert(0, [{'a':0, 'b':0, 'c':0}, {'a':1, 'b':1, 'c':1}]);}"
+                << "get(2).a = 456;"
+                << "a" << 2 << true << "get(2).a == 456" << dr;
         QTest::newRow("set: removed item")
                 << "{append({'a':0, 'b':0, 'c':0}); append({'a':123, 'b':456, 'c':789}); get(1); remove(0);}"
                 << "set(0, {'a':456});"
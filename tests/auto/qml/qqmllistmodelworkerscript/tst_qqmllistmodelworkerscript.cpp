@@ -117,6 +117,7 @@ private slots:
     void worker_remove_list();
     void dynamic_role_data();
     void dynamic_role();
+    void worker_incremental_sync();
 };
 
 bool tst_qqmllistmodelworkerscript::compareVariantList(const QVariantList &testList, QVariant object)
@@ -854,6 +855,44 @@ void tst_qqmllistmodelworkerscript::dynamic_role()
     qApp->processEvents();
 }
 
+void tst_qqmllistmodelworkerscript::worker_incremental_sync()
+{
+    // Each sync() only copies the elements changed since the previous one; check
+    // that elements left alone keep their values and that later changes still arrive.
+    QQmlListModel model;
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("model.qml"));
+    QQuickItem *item = createWorkerTest(&engine, &component, &model);
+    QVERIFY(item != 0);
+
+    QVariantList operations;
+    operations << "append([{'a':1, 'b':'one'}, {'a':2, 'b':'two'}, {'a':3, 'b':'three'}])";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+    QCOMPARE(model.count(), 3);
+
+    QQmlExpression first(engine.rootContext(), &model, "get(0).b");
+    QCOMPARE(first.evaluate().toString(), QString("one"));
+
+    operations.clear();
+    operations << "setProperty(1, 'a', 20)";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+
+    operations.clear();
+    operations << "set(2, {'a':30})" << "get(0).b = 'uno'";
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker", Q_ARG(QVariant, operations)));
+    waitForWorker(item);
+
+    QQmlExpression sum(engine.rootContext(), &model, "get(0).a + get(1).a + get(2).a");
+    QCOMPARE(sum.evaluate().toInt(), 51);
+    QQmlExpression names(engine.rootContext(), &model, "get(0).b + get(1).b + get(2).b");
+    QCOMPARE(names.evaluate().toString(), QString("unotwothree"));
+
+    delete item;
+    qApp->processEvents();
+}
+
 QTEST_MAIN(tst_qqmllistmodelworkerscript)
 
 #include "tst_qqmllistmodelworkerscript.moc"
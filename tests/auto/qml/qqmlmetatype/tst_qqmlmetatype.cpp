@@ -48,6 +48,7 @@
 #include <private/qqmlmetatype_p.h>
 #include <private/qqmlpropertyvalueinterceptor_p.h>
 #include <private/qhashedstring_p.h>
+#include <QtCore/qthread.h>
 #include "../../shared/util.h"
 
 class tst_qqmlmetatype : public QQmlDataTest
@@ -66,6 +67,7 @@ private slots:
     void invalidQmlTypeName();
     void registrationType();
     void compositeType();
+    void concurrentRegistration();
 
     void isList();
 
@@ -284,6 +286,50 @@ void tst_qqmlmetatype::compositeType()
     QCOMPARE(type->sourceUrl(), testFileUrl("ImplicitType.qml"));
 }
 
+static const int concurrentTypeCount = 500;
+
+static QUrl concurrentTypeUrl(int index)
+{
+    return QUrl(QString::fromLatin1("file:///concurrent/Type%1.qml").arg(index));
+}
+
+class CompositeTypeRegistrar : public QThread
+{
+public:
+    void run()
+    {
+        for (int i = 0; i < concurrentTypeCount; ++i) {
+            const QByteArray name = "Type" + QByteArray::number(i);
+            qmlRegisterType(concurrentTypeUrl(i), "Test.Concurrent", 1, 0, name.constData());
+        }
+    }
+};
+
+void tst_qqmlmetatype::concurrentRegistration()
+{
+    // Queries that interleave with registrations from another thread see either
+    // no type or the complete one.
+    CompositeTypeRegistrar registrar;
+    registrar.start();
+
+    int found = 0;
+    while (found < concurrentTypeCount) {
+        const bool finished = registrar.isFinished();
+        if (QQmlType *type = QQmlMetaType::qmlType(concurrentTypeUrl(found), true)) {
+            QCOMPARE(type->sourceUrl(), concurrentTypeUrl(found));
+            QCOMPARE(type->elementName(), QString::fromLatin1("Type%1").arg(found));
+            ++found;
+        } else {
+            QVERIFY(!finished);
+        }
+    }
+    QVERIFY(registrar.wait());
+
+    QQmlType *type = QQmlMetaType::qmlType(QString::fromLatin1("Test.Concurrent/Type%1").arg(concurrentTypeCount - 1), 1, 0);
+    QVERIFY(type);
+    QCOMPARE(type->sourceUrl(), concurrentTypeUrl(concurrentTypeCount - 1));
+}
+
 QTEST_MAIN(tst_qqmlmetatype)
 
 #include "tst_qqmlmetatype.moc"
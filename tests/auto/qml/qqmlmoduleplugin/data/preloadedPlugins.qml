@@ -0,0 +1,10 @@
+import QtQml 2.0
+import org.qtproject.AutoTestPreloadedPluginTypeA 1.0 as A
+import org.qtproject.AutoTestPreloadedPluginTypeB 1.0 as B
+
+QtObject {
+    property int value: a.value * 10 + b.value
+
+    property QtObject a: A.PreloadedA {}
+    property QtObject b: B.PreloadedB {}
+}
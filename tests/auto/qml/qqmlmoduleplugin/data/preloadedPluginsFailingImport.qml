@@ -0,0 +1,7 @@
+import QtQml 2.0
+import org.qtproject.AutoTestQmlNotInstalled 1.0
+import org.qtproject.AutoTestPreloadedPluginTypeA 1.0 as A
+import org.qtproject.AutoTestPreloadedPluginTypeB 1.0 as B
+
+QtObject {
+}
@@ -16,7 +16,9 @@ SUBDIRS =\
     preemptedStrictModule\
     invalidNamespaceModule\
     invalidFirstCommandModule\
-    protectedModule
+    protectedModule\
+    preloadedPluginA\
+    preloadedPluginB
 
 tst_qqmlmoduleplugin_pro.depends += plugin
 SUBDIRS += tst_qqmlmoduleplugin.pro
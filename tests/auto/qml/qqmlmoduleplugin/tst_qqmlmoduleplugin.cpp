@@ -43,6 +43,7 @@
 #include <QtQml/qqmlengine.h>
 #include <QtQml/qqmlcomponent.h>
 #include <QDebug>
+#include <QMutex>
 
 #include "../../shared/testhttpserver.h"
 #include "../../shared/util.h"
@@ -81,6 +82,7 @@ private slots:
     void importStrictModule();
     void importStrictModule_data();
     void importProtectedModule();
+    void preloadedPlugins();
 
 private:
     QString m_importsDirectory;
@@ -563,6 +565,74 @@ void tst_qqmlmoduleplugin::importProtectedModule()
     QVERIFY(object != 0);
 }
 
+static QMutex preloadedPlugins_mutex;
+static QStringList preloadedPlugins_messages;
+static void preloadedPlugins_messageHandler(QtMsgType type, const QMessageLogContext &, const QString &msg)
+{
+    // Plugins are instantiated on the loader workers when they are preloaded
+    QMutexLocker locker(&preloadedPlugins_mutex);
+    if (type == QtWarningMsg && msg.startsWith(QLatin1String("preloaded plugin")))
+        preloadedPlugins_messages.append(msg);
+}
+
+// Enables the loader workers and records the plugin messages for the lifetime of a test
+class PreloadedPluginsGuard
+{
+public:
+    PreloadedPluginsGuard()
+        : m_threads("QML_LOADER_THREADS", "2")
+        , m_previousMsgHandler(qInstallMessageHandler(preloadedPlugins_messageHandler))
+    {
+    }
+
+    ~PreloadedPluginsGuard()
+    {
+        qInstallMessageHandler(m_previousMsgHandler);
+    }
+
+private:
+    EnvironmentVariableGuard m_threads;
+    QtMessageHandler m_previousMsgHandler;
+};
+
+void tst_qqmlmoduleplugin::preloadedPlugins()
+{
+    PreloadedPluginsGuard guard;
+
+    {
+        // Both plugins are preloaded before the imports are processed, but the
+        // import that fails first means they are never registered.
+        QQmlEngine engine;
+        engine.addImportPath(m_importsDirectory);
+        QQmlComponent component(&engine, testFileUrl(QStringLiteral("preloadedPluginsFailingImport.qml")));
+        QCOMPARE(component.errors().count(), 1);
+        QCOMPARE(component.errors().first().description(),
+                 QString::fromLatin1("module \"org.qtproject.AutoTestQmlNotInstalled\" is not installed"));
+    }
+
+    QStringList messages = preloadedPlugins_messages;
+    messages.sort();
+    QCOMPARE(messages, QStringList() << "preloaded plugin A created" << "preloaded plugin B created");
+
+    {
+        // The plugins left over by the failed import have been unloaded, so they are
+        // created again, and only once, when they are preloaded for this import.
+        QQmlEngine engine;
+        engine.addImportPath(m_importsDirectory);
+        QQmlComponent component(&engine, testFileUrl(QStringLiteral("preloadedPlugins.qml")));
+        VERIFY_ERRORS(0);
+        QObject *object = component.create();
+        QVERIFY(object != 0);
+        QCOMPARE(object->property("value").toInt(), 12);
+        delete object;
+    }
+
+    messages = preloadedPlugins_messages;
+    messages.sort();
+    QCOMPARE(messages, QStringList() << "preloaded plugin A created" << "preloaded plugin A created"
+                                     << "preloaded plugin B created" << "preloaded plugin B created");
+}
+
 QTEST_MAIN(tst_qqmlmoduleplugin)
 
 #include "tst_qqmlmoduleplugin.moc"
@@ -44,6 +44,7 @@
 #include <private/qqmljslexer_p.h>
 #include <private/qqmljsastvisitor_p.h>
 #include <private/qqmljsast_p.h>
+#include <private/qqmljsmemorypool_p.h>
 
 #include <qtest.h>
 #include <QDir>
@@ -62,6 +63,9 @@ private slots:
     void qmlParser_data();
     void qmlParser();
 #endif
+    void lexer_data();
+    void lexer();
+    void memoryPoolReuse();
 
 private:
     QStringList excludedDirs;
@@ -205,6 +209,164 @@ void tst_qqmlparser::qmlParser()
 }
 #endif
 
+static QString lexerToken(const QString &text, int line, int column)
+{
+    return QString::fromLatin1("%1 %2:%3").arg(text).arg(line).arg(column);
+}
+
+/*
+The lexer skips runs of blanks, comment and string bodies and identifier tails in blocks
+of eight characters. These cases check that it stops at the right character when the
+interesting one is anywhere in a block, including the end of the input.
+*/
+
+void tst_qqmlparser::lexer_data()
+{
+    QTest::addColumn<QString>("code");
+    QTest::addColumn<QStringList>("expected");
+
+    for (int n = 0; n < 10; ++n) {
+        const QString body(n, QLatin1Char('x'));
+        QTest::newRow(qPrintable(QString::fromLatin1("block comment %1").arg(n)))
+                << QString::fromLatin1("a /*%1*/ b").arg(body)
+                << (QStringList() << lexerToken("a", 1, 1) << lexerToken("b", 1, 8 + n)
+                                  << QString::fromLatin1("comment %1").arg(body));
+    }
+    QTest::newRow("block comment stars")
+            << QString::fromLatin1("a /* ** * / ***/ b")
+            << (QStringList() << lexerToken("a", 1, 1) << lexerToken("b", 1, 18)
+                              << QString::fromLatin1("comment  ** * / **"));
+    QTest::newRow("unterminated line comment")
+            << QString::fromLatin1("a // xxxxxxxxxxxxxxxx")
+            << (QStringList() << lexerToken("a", 1, 1)
+                              << QString::fromLatin1("comment  xxxxxxxxxxxxxxxx"));
+
+    const QChar lineSeparator(0x2028);
+    const QChar paragraphSeparator(0x2029);
+    QTest::newRow("line separator in line comment")
+            << QString::fromLatin1("a // xxxxxxxxxx") + lineSeparator + QLatin1String("b")
+            << (QStringList() << lexerToken("a", 1, 1) << lexerToken("b", 2, 1)
+                              << QString::fromLatin1("comment  xxxxxxxxxx"));
+    QTest::newRow("paragraph separator in block comment")
+            << QString::fromLatin1("a /* xxxxxxxxx") + paragraphSeparator + QLatin1String("xx */ b")
+            << (QStringList() << lexerToken("a", 1, 1) << lexerToken("b", 2, 7)
+                              << QString::fromLatin1("comment  xxxxxxxxx") + paragraphSeparator + QLatin1String("xx "));
+    QTest::newRow("line separator before blanks")
+            << QString::fromLatin1("a") + lineSeparator + QLatin1String("          b")
+            << (QStringList() << lexerToken("a", 1, 1) << lexerToken("b", 2, 11));
+
+    const QString eAcutes(10, QChar(0xe9));
+    QTest::newRow("non-ASCII in line comment")
+            << QString::fromLatin1("a // ") + eAcutes + QLatin1String("\nb")
+            << (QStringList() << lexerToken("a", 1, 1) << lexerToken("b", 2, 1)
+                              << QString::fromLatin1("comment  ") + eAcutes);
+
+    const QChar eAcute(0xe9);
+    QTest::newRow("non-ASCII identifier part")
+            << QString::fromLatin1("abcdefgh") + eAcute + QLatin1String("ijklmnop q")
+            << (QStringList() << lexerToken(QString::fromLatin1("abcdefgh") + eAcute + QLatin1String("ijklmnop"), 1, 1)
+                              << lexerToken("q", 1, 19));
+    QTest::newRow("non-ASCII identifier start")
+            << eAcute + QString::fromLatin1("abcdefghijklmnop")
+            << (QStringList() << lexerToken(eAcute + QString::fromLatin1("abcdefghijklmnop"), 1, 1));
+    QTest::newRow("escaped identifier part")
+            << QString::fromLatin1("abc\\u0041defghijklmnop x")
+            << (QStringList() << lexerToken("abcAdefghijklmnop", 1, 1) << lexerToken("x", 1, 24));
+    QTest::newRow("identifier punctuation")
+            << QString::fromLatin1("_$a0123456789_$ z")
+            << (QStringList() << lexerToken("_$a0123456789_$", 1, 1) << lexerToken("z", 1, 17));
+
+    QString identifiers;
+    QStringList identifierTokens;
+    for (int n = 1; n <= 17; ++n) {
+        const QString identifier(n, QLatin1Char('a' + n % 26));
+        identifierTokens << lexerToken(identifier, 1, identifiers.length() + 1);
+        identifiers += identifier + QLatin1Char(' ');
+    }
+    identifiers.chop(1);
+    QTest::newRow("identifier lengths") << identifiers << identifierTokens;
+
+    QString strings;
+    QStringList stringTokens;
+    for (int n = 0; n <= 17; ++n) {
+        const QString text(n, QLatin1Char('s'));
+        stringTokens << lexerToken(text, 1, strings.length() + 1);
+        strings += QLatin1Char('\'') + text + QLatin1String("';");
+        stringTokens << lexerToken(";", 1, strings.length());
+    }
+    QTest::newRow("string lengths") << strings << stringTokens;
+    QTest::newRow("string escapes")
+            << QString::fromLatin1("'abcdefgh\\'ijklmnop\\n' x")
+            << (QStringList() << lexerToken("abcdefgh'ijklmnop\n", 1, 1) << lexerToken("x", 1, 24));
+    QTest::newRow("tabs and blanks")
+            << QString::fromLatin1("\t \t \t \t \t \t \t \t \t a")
+            << (QStringList() << lexerToken("a", 1, 19));
+}
+
+void tst_qqmlparser::lexer()
+{
+    QFETCH(QString, code);
+    QFETCH(QStringList, expected);
+
+    using namespace QQmlJS;
+
+    // Shifting the code by up to two blocks moves every character to every position
+    // in a block. Only the columns on the first line change.
+    for (int shift = 0; shift <= 16; ++shift) {
+        Engine engine;
+        Lexer lexer(&engine);
+        const QString shifted = QString(shift, QLatin1Char(' ')) + code;
+        lexer.setCode(shifted, 1, false);
+
+        QStringList tokens;
+        for (int token = lexer.lex(); token != QQmlJSGrammar::EOF_SYMBOL; token = lexer.lex()) {
+            const int line = lexer.tokenStartLine();
+            tokens << lexerToken(lexer.tokenText(), line, lexer.tokenStartColumn() - (line == 1 ? shift : 0));
+        }
+        foreach (const AST::SourceLocation &comment, engine.comments())
+            tokens << QLatin1String("comment ") + shifted.mid(comment.offset, comment.length);
+
+        QCOMPARE(tokens, expected);
+    }
+}
+
+static size_t parseAndMeasure(const QString &code, size_t *cachedWhileParsed)
+{
+    using namespace QQmlJS;
+
+    const size_t inUse = MemoryPool::bytesInUse();
+    Engine engine;
+    Lexer lexer(&engine);
+    lexer.setCode(code, 1, true);
+    Parser parser(&engine);
+    if (!parser.parse())
+        return 0;
+    *cachedWhileParsed = MemoryPool::bytesCached();
+    return MemoryPool::bytesInUse() - inUse;
+}
+
+void tst_qqmlparser::memoryPoolReuse()
+{
+    using namespace QQmlJS;
+
+    QString code = QLatin1String("import QtQuick 2.0\nItem {\n");
+    for (int i = 0; i < 200; ++i)
+        code += QString::fromLatin1("    property int p%1: %1 * width + height\n").arg(i);
+    code += QLatin1String("}\n");
+
+    // The first parse leaves its blocks in this thread's cache.
+    size_t cached = 0;
+    const size_t used = parseAndMeasure(code, &cached);
+    QVERIFY(used > 0);
+
+    // The second one takes them from there instead of allocating, and returns them.
+    const size_t cachedBefore = MemoryPool::bytesCached();
+    QVERIFY(cachedBefore >= used);
+    QCOMPARE(parseAndMeasure(code, &cached), used);
+    QCOMPARE(cached, cachedBefore - used);
+    QCOMPARE(MemoryPool::bytesCached(), cachedBefore);
+}
+
 QTEST_MAIN(tst_qqmlparser)
 
 #include "tst_qqmlparser.moc"
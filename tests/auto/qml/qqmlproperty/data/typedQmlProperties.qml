@@ -0,0 +1,24 @@
+import QtQml 2.0
+
+QtObject {
+    id: root
+
+    property int intProperty: 4
+    property real realProperty: intProperty * 1.5
+    property bool boolProperty: intProperty > 5
+    property string stringProperty: "value" + intProperty
+    property QtObject objectProperty: null
+    property variant variantProperty: intProperty
+
+    property int changes: 0
+    onIntPropertyChanged: ++changes
+    onObjectPropertyChanged: ++changes
+
+    property QtObject child: QtObject { objectName: "child" }
+
+    function assign() {
+        intProperty = 10
+        objectProperty = child
+        return intProperty + realProperty
+    }
+}
@@ -150,6 +150,7 @@ private slots:
     void assignEmptyVariantMap();
     void warnOnInvalidBinding();
     void registeredCompositeTypeProperty();
+    void typedQmlProperties();
 
     void copy();
 private:
@@ -1815,6 +1816,44 @@ void tst_qqmlproperty::aliasPropertyBindings()
     delete object;
 }
 
+void tst_qqmlproperty::typedQmlProperties()
+{
+    QQmlComponent component(&engine, testFileUrl("typedQmlProperties.qml"));
+    QObject *object = component.create();
+    QVERIFY(object != 0);
+
+    const char *typed[] = { "intProperty", "realProperty", "boolProperty",
+                            "stringProperty", "objectProperty" };
+    for (uint ii = 0; ii < sizeof(typed) / sizeof(typed[0]); ++ii) {
+        QQmlProperty property(object, QLatin1String(typed[ii]));
+        QVERIFY2(QQmlPropertyPrivate::get(property)->core.isVMEProperty(), typed[ii]);
+    }
+    QQmlProperty variantProperty(object, QLatin1String("variantProperty"));
+    QVERIFY(!QQmlPropertyPrivate::get(variantProperty)->core.isVMEProperty());
+
+    QCOMPARE(object->property("realProperty").toReal(), 6.);
+    QCOMPARE(object->property("boolProperty").toBool(), false);
+    QCOMPARE(object->property("stringProperty").toString(), QString("value4"));
+
+    int changes = object->property("changes").toInt();
+    QVariant result;
+    QMetaObject::invokeMethod(object, "assign", Q_RETURN_ARG(QVariant, result));
+    QCOMPARE(result.toReal(), 25.);
+
+    QCOMPARE(object->property("intProperty").toInt(), 10);
+    QCOMPARE(object->property("realProperty").toReal(), 15.);
+    QCOMPARE(object->property("boolProperty").toBool(), true);
+    QCOMPARE(object->property("stringProperty").toString(), QString("value10"));
+    QCOMPARE(object->property("variantProperty").toInt(), 10);
+    QCOMPARE(object->property("changes").toInt(), changes + 2);
+
+    QObject *child = object->property("child").value<QObject *>();
+    QVERIFY(child != 0);
+    QCOMPARE(object->property("objectProperty").value<QObject *>(), child);
+
+    delete object;
+}
+
 void tst_qqmlproperty::copy()
 {
     PropertyObject object;
@@ -43,6 +43,10 @@
 #include <QtQml/qqmlengine.h>
 #include <QtQuick/qquickview.h>
 #include <QtQuick/qquickitem.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/private/qqmlengine_p.h>
+#include <QtQml/private/qqmltypeloader_p.h>
+#include <QtQml/private/qqmlcomponentcachewatcher_p.h>
 #include "../../shared/util.h"
 
 class tst_QQMLTypeLoader : public QQmlDataTest
@@ -51,6 +55,15 @@ class tst_QQMLTypeLoader : public QQmlDataTest
 
 private slots:
     void testLoadComplete();
+    void clearChangedFiles();
+    void clearChangedFilesQmldir();
+    void componentCacheWatcher();
+    void concurrentParsing_data();
+    void concurrentParsing();
+    void concurrentParseError_data();
+    void concurrentParseError();
+    void importDiskCacheStaleMiss();
+    void importDiskCacheStaleHit();
 };
 
 void tst_QQMLTypeLoader::testLoadComplete()
@@ -69,6 +82,306 @@ void tst_QQMLTypeLoader::testLoadComplete()
     QTRY_COMPARE(rootObject->property("loaded").toInt(), 2);
 }
 
+static bool writeFile(const QString &path, const QByteArray &content)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    return file.write(content) == content.size();
+}
+
+void tst_QQMLTypeLoader::clearChangedFiles()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.path() + QLatin1Char('/');
+    QVERIFY(writeFile(path + "Main.qml", "import QtQml 2.0\nQtObject { property QtObject child: Child {} property QtObject other: Other {} }\n"));
+    QVERIFY(writeFile(path + "Child.qml", "import QtQml 2.0\nQtObject { property int value: 1 }\n"));
+    QVERIFY(writeFile(path + "Other.qml", "import QtQml 2.0\nQtObject { property int value: 2 }\n"));
+
+    const QUrl mainUrl = QUrl::fromLocalFile(path + "Main.qml");
+    const QUrl childUrl = QUrl::fromLocalFile(path + "Child.qml");
+    const QUrl otherUrl = QUrl::fromLocalFile(path + "Other.qml");
+
+    QQmlEngine engine;
+    QQmlTypeLoader &loader = QQmlEnginePrivate::get(&engine)->typeLoader;
+    loader.enableContentHashing();
+    {
+        QQmlComponent component(&engine, mainUrl);
+        QScopedPointer<QObject> object(component.create());
+        QVERIFY2(object, qPrintable(component.errorString()));
+        QCOMPARE(object->property("child").value<QObject *>()->property("value").toInt(), 1);
+    }
+
+    // nothing changed, nothing is dropped
+    QVERIFY(loader.clearChangedFiles().isEmpty());
+    QVERIFY(loader.isTypeLoaded(mainUrl));
+
+    QVERIFY(writeFile(path + "Child.qml", "import QtQml 2.0\nQtObject { property int value: 3 }\n"));
+    const QList<QUrl> cleared = loader.clearChangedFiles();
+    QCOMPARE(cleared.count(), 2);
+    QVERIFY(cleared.contains(childUrl));
+    QVERIFY(cleared.contains(mainUrl));
+    QVERIFY(loader.isTypeLoaded(otherUrl));
+    QVERIFY(!loader.isTypeLoaded(childUrl));
+
+    {
+        QQmlComponent component(&engine, mainUrl);
+        QScopedPointer<QObject> object(component.create());
+        QVERIFY2(object, qPrintable(component.errorString()));
+        QCOMPARE(object->property("child").value<QObject *>()->property("value").toInt(), 3);
+        QCOMPARE(object->property("other").value<QObject *>()->property("value").toInt(), 2);
+    }
+    loader.disableContentHashing();
+}
+
+void tst_QQMLTypeLoader::clearChangedFilesQmldir()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.path() + QLatin1Char('/');
+    QVERIFY(QDir().mkpath(path + "module"));
+    // The comment is not valid UTF-8, so the parsed content differs from the file.
+    QVERIFY(writeFile(path + "module/qmldir", "# caf\xe9\nThing 1.0 Thing.qml\n"));
+    QVERIFY(writeFile(path + "module/Thing.qml", "import QtQml 2.0\nQtObject { property int value: 1 }\n"));
+    QVERIFY(writeFile(path + "Main.qml", "import QtQml 2.0\nimport \"module\"\nQtObject { property QtObject thing: Thing {} }\n"));
+    QVERIFY(writeFile(path + "Other.qml", "import QtQml 2.0\nQtObject {}\n"));
+
+    const QUrl mainUrl = QUrl::fromLocalFile(path + "Main.qml");
+    const QUrl otherUrl = QUrl::fromLocalFile(path + "Other.qml");
+
+    QQmlEngine engine;
+    QQmlTypeLoader &loader = QQmlEnginePrivate::get(&engine)->typeLoader;
+    loader.enableContentHashing();
+    {
+        QQmlComponent component(&engine, mainUrl);
+        QScopedPointer<QObject> object(component.create());
+        QVERIFY2(object, qPrintable(component.errorString()));
+        QQmlComponent other(&engine, otherUrl);
+        QScopedPointer<QObject> otherObject(other.create());
+        QVERIFY2(otherObject, qPrintable(other.errorString()));
+    }
+
+    // An unchanged qmldir does not clear the cache
+    QVERIFY(loader.clearChangedFiles().isEmpty());
+    QVERIFY(loader.isTypeLoaded(otherUrl));
+
+    // A changed qmldir clears everything
+    QVERIFY(writeFile(path + "module/qmldir", "# caf\xe9\nThing 1.0 Thing.qml\nThing 1.1 Thing.qml\n"));
+    const QList<QUrl> cleared = loader.clearChangedFiles();
+    QVERIFY(cleared.contains(mainUrl));
+    QVERIFY(cleared.contains(otherUrl));
+    QVERIFY(!loader.isTypeLoaded(otherUrl));
+    loader.disableContentHashing();
+}
+
+void tst_QQMLTypeLoader::componentCacheWatcher()
+{
+    qRegisterMetaType<QList<QUrl> >();
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.path() + QLatin1Char('/');
+    QVERIFY(writeFile(path + "Main.qml", "import QtQml 2.0\nQtObject { property QtObject child: Child {} }\n"));
+    QVERIFY(writeFile(path + "Child.qml", "import QtQml 2.0\nQtObject { property int value: 1 }\n"));
+
+    const QUrl mainUrl = QUrl::fromLocalFile(path + "Main.qml");
+    const QUrl childUrl = QUrl::fromLocalFile(path + "Child.qml");
+
+    QQmlEngine engine;
+    QQmlTypeLoader &loader = QQmlEnginePrivate::get(&engine)->typeLoader;
+    {
+        QQmlComponent component(&engine, mainUrl);
+        QScopedPointer<QObject> object(component.create());
+        QVERIFY2(object, qPrintable(component.errorString()));
+    }
+
+    // Without a watcher the content of loaded files is not hashed
+    QQmlTypeData *typeData = loader.getType(childUrl);
+    QVERIFY(typeData->contentHash().isEmpty());
+
+    QQmlComponentCacheWatcher *watcher = new QQmlComponentCacheWatcher(&engine);
+    watcher->setDelay(0);
+    QVERIFY(!typeData->contentHash().isEmpty());
+    typeData->release();
+
+    QSignalSpy spy(watcher, SIGNAL(componentsInvalidated(QList<QUrl>)));
+    QVERIFY(writeFile(path + "Child.qml", "import QtQml 2.0\nQtObject { property int value: 2 }\n"));
+    QTRY_COMPARE(spy.count(), 1);
+    const QList<QUrl> cleared = spy.at(0).at(0).value<QList<QUrl> >();
+    QCOMPARE(cleared.count(), 2);
+    QVERIFY(cleared.contains(childUrl));
+    QVERIFY(cleared.contains(mainUrl));
+
+    {
+        QQmlComponent component(&engine, mainUrl);
+        QScopedPointer<QObject> object(component.create());
+        QVERIFY2(object, qPrintable(component.errorString()));
+        QCOMPARE(object->property("child").value<QObject *>()->property("value").toInt(), 2);
+    }
+
+    // Files loaded again are watched and hashed while the watcher exists
+    watcher->watchLoadedFiles();
+    QVERIFY(writeFile(path + "Child.qml", "import QtQml 2.0\nQtObject { property int value: 3 }\n"));
+    QTRY_COMPARE(spy.count(), 2);
+    QVERIFY(spy.at(1).at(0).value<QList<QUrl> >().contains(childUrl));
+
+    delete watcher;
+}
+
+void tst_QQMLTypeLoader::concurrentParsing_data()
+{
+    QTest::addColumn<QByteArray>("threads");
+
+    QTest::newRow("load thread") << QByteArray("0");
+    QTest::newRow("workers") << QByteArray("4");
+}
+
+void tst_QQMLTypeLoader::concurrentParsing()
+{
+    QFETCH(QByteArray, threads);
+    EnvironmentVariableGuard guard("QML_LOADER_THREADS", threads);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.path() + QLatin1Char('/');
+
+    // A tree of types several levels deep, so that parses of dependencies found while
+    // processing earlier parses are outstanding together.
+    const int count = 24;
+    QByteArray children;
+    QByteArray values;
+    for (int ii = 0; ii < count; ++ii) {
+        const QByteArray number = QByteArray::number(ii);
+        QVERIFY(writeFile(path + "Type" + number + ".qml",
+                "import QtQml 2.0\nQtObject { property QtObject leaf: Leaf" + number + " {}\n"
+                "property int value: leaf.value * 2 }\n"));
+        QVERIFY(writeFile(path + "Leaf" + number + ".qml",
+                "import QtQml 2.0\nQtObject { property int value: " + number + " }\n"));
+        children += (ii ? ", " : "") + QByteArray("Type") + number + " { id: t" + number + " }";
+        values += (ii ? ", " : "") + QByteArray("t") + number + ".value";
+    }
+    const QByteArray main = "import QtQml 2.0\nQtObject {\n"
+            "    property list<QtObject> children: [" + children + "]\n"
+            "    property var values: [" + values + "]\n}\n";
+    QVERIFY(writeFile(path + "Main.qml", main));
+
+    QQmlEngine engine;
+    QCOMPARE(QQmlEnginePrivate::get(&engine)->typeLoader.workerPool() != 0, threads != "0");
+
+    // Local files are loaded synchronously, whichever thread parses them.
+    QQmlComponent component(&engine, QUrl::fromLocalFile(path + "Main.qml"));
+    QCOMPARE(component.status(), QQmlComponent::Ready);
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object, qPrintable(component.errorString()));
+
+    const QVariantList result = object->property("values").toList();
+    QCOMPARE(result.count(), count);
+    for (int ii = 0; ii < count; ++ii)
+        QCOMPARE(result.at(ii).toInt(), ii * 2);
+}
+
+void tst_QQMLTypeLoader::concurrentParseError_data()
+{
+    concurrentParsing_data();
+}
+
+void tst_QQMLTypeLoader::concurrentParseError()
+{
+    QFETCH(QByteArray, threads);
+    EnvironmentVariableGuard guard("QML_LOADER_THREADS", threads);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.path() + QLatin1Char('/');
+    QVERIFY(writeFile(path + "Main.qml", "import QtQml 2.0\nQtObject {\n    property QtObject a: Good {}\n    property QtObject b: Broken {}\n}\n"));
+    QVERIFY(writeFile(path + "Good.qml", "import QtQml 2.0\nQtObject { property int value: 1 }\n"));
+    QVERIFY(writeFile(path + "Broken.qml", "import QtQml 2.0\nQtObject {\n    property int value: 1\n    }}\n"));
+
+    // Errors raised by a worker are reported exactly as when parsing in the load thread.
+    QQmlEngine engine;
+    QQmlComponent component(&engine, QUrl::fromLocalFile(path + "Main.qml"));
+    QCOMPARE(component.status(), QQmlComponent::Error);
+    const QList<QQmlError> errors = component.errors();
+    QCOMPARE(errors.count(), 2);
+    QCOMPARE(errors.at(0).url(), QUrl::fromLocalFile(path + "Main.qml"));
+    QCOMPARE(errors.at(0).line(), 4);
+    QCOMPARE(errors.at(0).description(), QString("Type Broken unavailable"));
+    QCOMPARE(errors.at(1).url(), QUrl::fromLocalFile(path + "Broken.qml"));
+    QCOMPARE(errors.at(1).line(), 4);
+}
+
+// Creates an engine importing from \a importPaths and returns the value property of the
+// object created from \a source, or -1.  The engine saves the import cache when it is
+// destroyed on return.
+static int importedValue(const QStringList &importPaths, const QString &directory,
+                         const QByteArray &source)
+{
+    QQmlEngine engine;
+    foreach (const QString &importPath, importPaths)
+        engine.addImportPath(importPath);
+    QQmlComponent component(&engine);
+    component.setData(source, QUrl::fromLocalFile(directory + QLatin1String("/main.qml")));
+    QScopedPointer<QObject> object(component.create());
+    if (!object)
+        qWarning() << component.errorString();
+    return object ? object->property("value").toInt() : -1;
+}
+
+// Modification times may have a granularity of a second.
+static void waitForNewModificationTime()
+{
+    QTest::qSleep(1100);
+}
+
+void tst_QQMLTypeLoader::importDiskCacheStaleMiss()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString importPath = dir.path() + QLatin1String("/imports");
+    QVERIFY(QDir().mkpath(importPath + QLatin1String("/Cached")));
+    EnvironmentVariableGuard guard("QML_IMPORT_CACHE", QFile::encodeName(dir.path() + QLatin1String("/importcache")));
+
+    const QByteArray source = "import Cached.Module 1.0\nThing {}\n";
+    QCOMPARE(importedValue(QStringList() << importPath, dir.path(), source), -1);
+    QVERIFY(QFile::exists(dir.path() + QLatin1String("/importcache")));
+
+    // The module appears below an existing directory, which leaves the import path
+    // itself unmodified.
+    waitForNewModificationTime();
+    QVERIFY(QDir().mkpath(importPath + QLatin1String("/Cached/Module")));
+    QVERIFY(writeFile(importPath + "/Cached/Module/qmldir", "module Cached.Module\nThing 1.0 Thing.qml\n"));
+    QVERIFY(writeFile(importPath + "/Cached/Module/Thing.qml", "import QtQml 2.0\nQtObject { property int value: 1 }\n"));
+
+    QCOMPARE(importedValue(QStringList() << importPath, dir.path(), source), 1);
+}
+
+void tst_QQMLTypeLoader::importDiskCacheStaleHit()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString lowImportPath = dir.path() + QLatin1String("/low");
+    const QString highImportPath = dir.path() + QLatin1String("/high");
+    QVERIFY(QDir().mkpath(lowImportPath + QLatin1String("/Cached/Module")));
+    QVERIFY(QDir().mkpath(highImportPath + QLatin1String("/Cached")));
+    QVERIFY(writeFile(lowImportPath + "/Cached/Module/qmldir", "module Cached.Module\nThing 1.0 Thing.qml\n"));
+    QVERIFY(writeFile(lowImportPath + "/Cached/Module/Thing.qml", "import QtQml 2.0\nQtObject { property int value: 1 }\n"));
+    EnvironmentVariableGuard guard("QML_IMPORT_CACHE", QFile::encodeName(dir.path() + QLatin1String("/importcache")));
+
+    // Import paths added later take precedence.
+    const QStringList importPaths = QStringList() << lowImportPath << highImportPath;
+    const QByteArray source = "import Cached.Module 1.0\nThing {}\n";
+    QCOMPARE(importedValue(importPaths, dir.path(), source), 1);
+
+    // A versioned directory in a path with higher precedence hides the cached module.
+    waitForNewModificationTime();
+    QVERIFY(QDir().mkpath(highImportPath + QLatin1String("/Cached/Module.1")));
+    QVERIFY(writeFile(highImportPath + "/Cached/Module.1/qmldir", "module Cached.Module\nThing 1.0 Thing.qml\n"));
+    QVERIFY(writeFile(highImportPath + "/Cached/Module.1/Thing.qml", "import QtQml 2.0\nQtObject { property int value: 2 }\n"));
+
+    QCOMPARE(importedValue(importPaths, dir.path(), source), 2);
+}
+
 QTEST_MAIN(tst_QQMLTypeLoader)
 
 #include "tst_qqmltypeloader.moc"
@@ -0,0 +1,5 @@
+WorkerScript.onMessage = function(msg) {
+    msg.model.append({ value: msg.value })
+    msg.model.sync()
+    WorkerScript.sendMessage(msg.model.count)
+}
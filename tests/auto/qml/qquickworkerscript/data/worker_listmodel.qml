@@ -0,0 +1,16 @@
+import QtQuick 2.0
+
+Item {
+    property alias model: listModel
+    property alias first: firstWorker
+    property alias second: secondWorker
+
+    ListModel { id: listModel }
+
+    BaseWorker { id: firstWorker; source: "script_listmodel.js" }
+    BaseWorker { id: secondWorker; source: "script_listmodel.js" }
+
+    function append(worker, value) {
+        worker.sendMessage({ model: listModel, value: value })
+    }
+}
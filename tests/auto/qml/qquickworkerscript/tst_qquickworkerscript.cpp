@@ -43,6 +43,7 @@
 #include <QtCore/qtimer.h>
 #include <QtCore/qdir.h>
 #include <QtCore/qfileinfo.h>
+#include <QtCore/qsemaphore.h>
 #include <QtQml/qjsengine.h>
 
 #include <QtQml/qqmlcomponent.h>
@@ -69,6 +70,9 @@ private slots:
     void scriptError_onLoad();
     void scriptError_onCall();
     void stressDispose();
+    void singleThreadByDefault();
+    void busyWorkerDoesNotBlockOthers();
+    void listModelSharedBetweenWorkers();
 
 private:
     void waitForEchoMessage(QQuickWorkerScript *worker) {
@@ -137,6 +141,16 @@ void tst_QQuickWorkerScript::messaging_data()
     QTest::newRow("string") << qVariantFromValue(QString("More cheeeese, Gromit!"));
     QTest::newRow("variant list") << qVariantFromValue((QVariantList() << "a" << "b" << "c"));
     QTest::newRow("date time") << qVariantFromValue(QDateTime::currentDateTime());
+    QTest::newRow("long string") << qVariantFromValue(QString(4096, QLatin1Char('x')));
+
+    QVariantList numbers;
+    for (int i = 0; i < 64; ++i)
+        numbers << qVariantFromValue(i + 0.5);
+    QTest::newRow("number list") << qVariantFromValue(numbers);
+
+    QVariantList mixed = numbers;
+    mixed.insert(40, qVariantFromValue(QString("not a number")));
+    QTest::newRow("mixed list") << qVariantFromValue(mixed);
 #ifndef QT_NO_REGEXP
     // Qt Script's QScriptValue -> QRegExp uses RegExp2 pattern syntax
     QTest::newRow("regexp") << qVariantFromValue(QRegExp("^\\d\\d?$", Qt::CaseInsensitive, QRegExp::RegExp2));
@@ -296,6 +310,115 @@ void tst_QQuickWorkerScript::stressDispose()
     }
 }
 
+// Blocks the thread it lives in from the time it receives an event until it is released
+class ThreadBlocker : public QObject
+{
+public:
+    QSemaphore blocked;
+    QSemaphore released;
+
+protected:
+    bool event(QEvent *event)
+    {
+        if (event->type() != QEvent::User)
+            return QObject::event(event);
+        blocked.release();
+        released.acquire();
+        return true;
+    }
+};
+
+void tst_QQuickWorkerScript::singleThreadByDefault()
+{
+    EnvironmentVariableGuard threads("QML_WORKERSCRIPT_THREADS", "");
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("worker.qml"));
+    QScopedPointer<QQuickWorkerScript> first(qobject_cast<QQuickWorkerScript*>(component.create()));
+    QVERIFY(first != 0);
+    QScopedPointer<QQuickWorkerScript> second(qobject_cast<QQuickWorkerScript*>(component.create()));
+    QVERIFY(second != 0);
+
+    QQmlEnginePrivate *ep = QQmlEnginePrivate::get(&engine);
+    QCOMPARE(ep->workerScriptEngines.count(), 1);
+    QCOMPARE(ep->workerScriptEngines.at(0)->workerScriptCount(), 2);
+}
+
+void tst_QQuickWorkerScript::busyWorkerDoesNotBlockOthers()
+{
+    EnvironmentVariableGuard threads("QML_WORKERSCRIPT_THREADS", "2");
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("worker.qml"));
+    QScopedPointer<QQuickWorkerScript> busy(qobject_cast<QQuickWorkerScript*>(component.create()));
+    QVERIFY(busy != 0);
+    QScopedPointer<QQuickWorkerScript> echo(qobject_cast<QQuickWorkerScript*>(component.create()));
+    QVERIFY(echo != 0);
+
+    // The first script is started in the first engine, the second one gets an engine of its own
+    QQmlEnginePrivate *ep = QQmlEnginePrivate::get(&engine);
+    QCOMPARE(ep->workerScriptEngines.count(), 2);
+
+    ThreadBlocker *blocker = new ThreadBlocker;
+    blocker->moveToThread(ep->workerScriptEngines.at(0));
+    QCoreApplication::postEvent(blocker, new QEvent(QEvent::User));
+    blocker->blocked.acquire();
+
+    QVERIFY(QMetaObject::invokeMethod(busy.data(), "testSend", Q_ARG(QVariant, qVariantFromValue(1))));
+    QVERIFY(QMetaObject::invokeMethod(echo.data(), "testSend", Q_ARG(QVariant, qVariantFromValue(42))));
+    waitForEchoMessage(echo.data());
+    QCOMPARE(echo->property("response").value<QVariant>(), qVariantFromValue(42));
+    QVERIFY(!busy->property("response").isValid());
+
+    blocker->released.release();
+    blocker->deleteLater();
+    waitForEchoMessage(busy.data());
+    QCOMPARE(busy->property("response").value<QVariant>(), qVariantFromValue(1));
+}
+
+void tst_QQuickWorkerScript::listModelSharedBetweenWorkers()
+{
+    EnvironmentVariableGuard threads("QML_WORKERSCRIPT_THREADS", "2");
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("worker_listmodel.qml"));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(root != 0);
+    QQuickWorkerScript *first = qobject_cast<QQuickWorkerScript*>(root->property("first").value<QObject*>());
+    QVERIFY(first != 0);
+    QQuickWorkerScript *second = qobject_cast<QQuickWorkerScript*>(root->property("second").value<QObject*>());
+    QVERIFY(second != 0);
+    QObject *model = root->property("model").value<QObject*>();
+    QVERIFY(model != 0);
+
+    QQmlEnginePrivate *ep = QQmlEnginePrivate::get(&engine);
+    QCOMPARE(ep->workerScriptEngines.count(), 2);
+    QCOMPARE(ep->workerScriptEngines.at(0)->workerScriptCount(), 1);
+    QCOMPARE(ep->workerScriptEngines.at(1)->workerScriptCount(), 1);
+
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "append", Q_ARG(QVariant, qVariantFromValue<QObject*>(first)), Q_ARG(QVariant, 1)));
+    waitForEchoMessage(first);
+    QCOMPARE(first->property("response").toInt(), 1);
+
+    // The ListModel's worker copy belongs to the first engine, so it cannot be sent to the second one
+    {
+        QQmlTestMessageHandler messageHandler;
+        QVERIFY(QMetaObject::invokeMethod(root.data(), "append", Q_ARG(QVariant, qVariantFromValue<QObject*>(second)), Q_ARG(QVariant, 2)));
+        QCOMPARE(messageHandler.messages().count(), 1);
+        QVERIFY(messageHandler.messageString().endsWith(QLatin1String("Cannot send a ListModel that is used by a WorkerScript in another thread")));
+    }
+    QCOMPARE(ep->workerScriptEngines.at(0)->workerScriptCount(), 1);
+    QCOMPARE(ep->workerScriptEngines.at(1)->workerScriptCount(), 1);
+
+    // The script that owns the ListModel can still use it
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "append", Q_ARG(QVariant, qVariantFromValue<QObject*>(first)), Q_ARG(QVariant, 3)));
+    waitForEchoMessage(first);
+    QCOMPARE(first->property("response").toInt(), 2);
+
+    QVERIFY(!second->property("response").isValid());
+    QCOMPARE(model->property("count").toInt(), 2);
+}
+
 QTEST_MAIN(tst_QQuickWorkerScript)
 
 #include "tst_qquickworkerscript.moc"
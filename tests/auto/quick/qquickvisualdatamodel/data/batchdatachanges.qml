@@ -0,0 +1,12 @@
+import QtQuick 2.0
+import QtQml.Models 2.2
+
+DelegateModel {
+    model: myModel
+    batchDataChanges: true
+    delegate: Item {
+        property string itemName: name
+        property int updates: 0
+        onItemNameChanged: ++updates
+    }
+}
@@ -0,0 +1,8 @@
+import QtQuick 2.0
+import QtQml.Models 2.2
+
+DelegateModel {
+    model: myModel
+    keyRole: "name"
+    delegate: Item { property string itemName: name }
+}
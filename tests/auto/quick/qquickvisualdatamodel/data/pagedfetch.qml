@@ -0,0 +1,9 @@
+import QtQuick 2.0
+import QtQml.Models 2.2
+
+DelegateModel {
+    model: myModel
+    pageSize: 10
+    pageCacheSize: 2
+    delegate: Item { property string itemName: name }
+}
@@ -0,0 +1,32 @@
+import QtQuick 2.2
+import QtQml.Models 2.2
+
+ListView {
+    id: view
+
+    property int createdCount: 0
+    property int pooledCount: 0
+    property int reusedCount: 0
+
+    width: 100
+    height: 100
+    cacheBuffer: 0
+
+    model: DelegateModel {
+        objectName: "visualModel"
+        reuseItems: true
+        model: myModel
+        delegate: Item {
+            objectName: "delegate"
+            width: parent.width
+            height: 20
+
+            property int itemIndex: index
+            property string itemName: name
+
+            Component.onCompleted: ++view.createdCount
+            DelegateModel.onPooled: ++view.pooledCount
+            DelegateModel.onReused: ++view.reusedCount
+        }
+    }
+}
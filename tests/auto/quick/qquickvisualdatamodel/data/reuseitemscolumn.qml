@@ -0,0 +1,36 @@
+import QtQuick 2.2
+import QtQml.Models 2.2
+
+Column {
+    id: column
+
+    property int reusedCount: 0
+
+    width: 20
+
+    Repeater {
+        model: DelegateModel {
+            reuseItems: true
+            model: ListModel {
+                id: listModel
+                ListElement { name: "a" }
+                ListElement { name: "b" }
+                ListElement { name: "c" }
+                ListElement { name: "d" }
+                ListElement { name: "e" }
+            }
+            delegate: Rectangle {
+                objectName: "delegate"
+                width: 20
+                height: 20
+
+                property string itemName: name
+
+                DelegateModel.onReused: ++column.reusedCount
+            }
+        }
+    }
+
+    function removeItems(index, count) { listModel.remove(index, count) }
+    function appendItem(name) { listModel.append({ name: name }) }
+}
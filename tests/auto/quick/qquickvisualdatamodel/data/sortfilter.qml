@@ -0,0 +1,24 @@
+import QtQuick 2.0
+import QtQml.Models 2.2
+
+DelegateModel {
+    function names() {
+        var result = []
+        for (var i = 0; i < items.count; ++i)
+            result.push(items.get(i).model.name)
+        return result.join(",")
+    }
+
+    model: ListModel {
+        id: listModel
+        objectName: "listModel"
+        ListElement { name: "delta"; size: 4 }
+        ListElement { name: "alpha"; size: 12 }
+        ListElement { name: "echo"; size: 5 }
+        ListElement { name: "charlie"; size: 3 }
+        ListElement { name: "bravo"; size: 10 }
+    }
+    delegate: Item {}
+
+    sortRole: "name"
+}
@@ -0,0 +1,16 @@
+import QtQuick 2.0
+import QtQml.Models 2.2
+
+DelegateModel {
+    function values() {
+        var result = []
+        for (var i = 0; i < items.count; ++i)
+            result.push(String(items.get(i).model.display))
+        return result.join(",")
+    }
+
+    model: myModel
+    delegate: Item {}
+
+    sortRole: "display"
+}
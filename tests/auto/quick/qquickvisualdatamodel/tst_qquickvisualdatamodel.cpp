@@ -51,6 +51,7 @@
 #include <QtQml/qqmlincubator.h>
 #include <QtQuick/qquickview.h>
 #include <private/qquicklistview_p.h>
+#include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qquicktext_p.h>
 #include <QtQml/private/qqmldelegatemodel_p.h>
 #include <private/qqmlvaluetype_p.h>
@@ -219,6 +220,15 @@ public:
         return list;
     }
 
+    void resetList(const QStringList &l) {
+        beginResetModel();
+        foreach (const Node &child, trunk.children) delete child.branch;
+        trunk.children.clear();
+        foreach (const QString &string, l)
+            trunk.children.append(Node(string));
+        endResetModel();
+    }
+
     void setList(const QStringList &l) {
         if (trunk.children.count() > 0) {
             beginRemoveRows(QModelIndex(), 0, trunk.children.count() - 1);
@@ -246,6 +256,47 @@ private:
     Branch trunk;
 };
 
+class PagedModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    PagedModel(int count, QObject *parent = 0)
+        : QAbstractListModel(parent), loaded(count, false) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const {
+        return parent.isValid() ? 0 : loaded.count(); }
+
+    QVariant data(const QModelIndex &index, int role) const {
+        if (role != Qt::DisplayRole)
+            return QVariant();
+        return loaded.at(index.row()) ? QString("row %1").arg(index.row()) : QString("loading"); }
+
+    QHash<int, QByteArray> roleNames() const {
+        QHash<int, QByteArray> roles;
+        roles.insert(Qt::DisplayRole, "name");
+        return roles; }
+
+    Q_INVOKABLE void fetchRows(const QModelIndex &, int first, int count) {
+        fetched << QString("%1,%2").arg(first).arg(count);
+        for (int i = first; i < first + count; ++i)
+            loaded[i] = true;
+        emit dataChanged(index(first), index(first + count - 1)); }
+
+    Q_INVOKABLE void releaseRows(const QModelIndex &, int first, int count) {
+        released << QString("%1,%2").arg(first).arg(count);
+        for (int i = first; i < first + count; ++i)
+            loaded[i] = false; }
+
+    void insert(int row, int count) {
+        beginInsertRows(QModelIndex(), row, row + count - 1);
+        loaded.insert(row, count, false);
+        endInsertRows(); }
+
+    QVector<bool> loaded;
+    QStringList fetched;
+    QStringList released;
+};
+
 class StandardItem : public QObject, public QStandardItem
 {
     Q_OBJECT
@@ -438,6 +489,14 @@ private slots:
     void asynchronousMove_data();
     void asynchronousCancel();
     void invalidContext();
+    void sortAndFilter();
+    void sortManyItems();
+    void sortMixedTypes();
+    void reuseItems();
+    void reuseItemsInColumn();
+    void keyedReset();
+    void batchDataChanges();
+    void pagedFetch();
 
 private:
     template <int N> void groups_verify(
@@ -4243,6 +4302,454 @@ void tst_qquickvisualdatamodel::invalidContext()
     QVERIFY(!item);
 }
 
+void tst_qquickvisualdatamodel::sortAndFilter()
+{
+    QQmlComponent component(&engine, testFileUrl("sortfilter.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(visualModel);
+
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("alpha,bravo,charlie,delta,echo"));
+
+    visualModel->setSortOrder(Qt::DescendingOrder);
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("echo,delta,charlie,bravo,alpha"));
+
+    // Numbers compare as numbers rather than strings.
+    visualModel->setSortRole("size");
+    visualModel->setSortOrder(Qt::AscendingOrder);
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("charlie,delta,echo,bravo,alpha"));
+
+    QSignalSpy countSpy(visualModel->items(), SIGNAL(countChanged()));
+    visualModel->setFilterRole("name");
+    visualModel->setFilterExpression(QRegExp("^[a-d]"));
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(visualModel->items()->count(), 4);
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("charlie,delta,bravo,alpha"));
+
+    // Inserted and changed items are filtered and sorted.
+    evaluate<void>(visualModel, "model.append({ name: \"able\", size: 1 })");
+    evaluate<void>(visualModel, "model.append({ name: \"foxtrot\", size: 2 })");
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("able,charlie,delta,bravo,alpha"));
+
+    evaluate<void>(visualModel, "model.setProperty(0, \"size\", 20)");
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("able,charlie,bravo,alpha,delta"));
+
+    evaluate<void>(visualModel, "model.setProperty(1, \"name\", \"golf\")");
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("able,charlie,bravo,delta"));
+
+    // Clearing the filter restores all the items in sorted order.
+    visualModel->setFilterRole(QString());
+    QCOMPARE(visualModel->items()->count(), 7);
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("able,foxtrot,charlie,echo,bravo,golf,delta"));
+
+    // Clearing the sort role leaves the items in their current order.
+    visualModel->setSortRole(QString());
+    QCOMPARE(evaluate<QString>(visualModel, "names()"), QString("able,foxtrot,charlie,echo,bravo,golf,delta"));
+}
+
+void tst_qquickvisualdatamodel::sortMixedTypes()
+{
+    QStandardItemModel model;
+    const QVariant values[] = { QVariant("b"), QVariant(3), QVariant("a"), QVariant(), QVariant(10), QVariant(2.5) };
+    for (unsigned i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+        QStandardItem *item = new QStandardItem;
+        if (values[i].isValid())
+            item->setData(values[i], Qt::DisplayRole);
+        model.appendRow(item);
+    }
+
+    QQmlEngine engine;
+    engine.rootContext()->setContextProperty("myModel", &model);
+    QQmlComponent component(&engine, testFileUrl("sortmixed.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(visualModel);
+
+    // Values are ordered by kind first, so the order is the same whatever the input order.
+    QCOMPARE(evaluate<QString>(visualModel, "values()"), QString("undefined,2.5,3,10,a,b"));
+
+    visualModel->setSortOrder(Qt::DescendingOrder);
+    QCOMPARE(evaluate<QString>(visualModel, "values()"), QString("b,a,10,3,2.5,undefined"));
+}
+
+void tst_qquickvisualdatamodel::sortManyItems()
+{
+    QQmlComponent component(&engine, testFileUrl("sortfilter.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(visualModel);
+
+    visualModel->setSortRole("size");
+    evaluate<void>(visualModel,
+            "model.clear();"
+            "for (var i = 0; i < 200; ++i)"
+                "model.append({ name: \"item \" + i, size: i })");
+    QCOMPARE(visualModel->items()->count(), 200);
+
+    const char *inOrder =
+            "(function() {"
+                "for (var i = 0; i < items.count; ++i) {"
+                    "var item = items.get(i);"
+                    "if (item.itemsIndex != i || item.model.size != (%1 ? 199 - i : i))"
+                        "return false;"
+                "}"
+                "return true;"
+            "})()";
+    QVERIFY(evaluate<bool>(visualModel, QString(inOrder).arg("false")));
+
+    // Reversing the order moves more items than are moved one by one, so the groups are reset
+    // instead, the cached items still have to end up at the right index.
+    visualModel->setSortOrder(Qt::DescendingOrder);
+    QVERIFY(evaluate<bool>(visualModel, QString(inOrder).arg("true")));
+
+    // Moving a few items still moves them one by one.
+    evaluate<void>(visualModel, "model.setProperty(0, \"size\", 250)");
+    QVERIFY(evaluate<bool>(visualModel,
+            "items.get(0).model.name == \"item 0\" && items.get(1).model.name == \"item 199\""));
+}
+
+void tst_qquickvisualdatamodel::reuseItems()
+{
+    QStringList list;
+    for (int i = 0; i < 100; ++i)
+        list << QString("item %1").arg(i);
+    SingleRoleModel model(list);
+
+    // The delegate binds to its parent, which pooled items keep.
+    QQmlTestMessageHandler messageHandler;
+
+    QQuickView view;
+    view.rootContext()->setContextProperty("myModel", &model);
+    view.setSource(testFileUrl("reuseitems.qml"));
+
+    QQuickListView *listView = qobject_cast<QQuickListView *>(view.rootObject());
+    QVERIFY(listView);
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(listView->model().value<QObject *>());
+    QVERIFY(visualModel);
+    QVERIFY(visualModel->reuseItems());
+
+    listView->forceLayout();
+    const int initialCount = listView->property("createdCount").toInt();
+    QVERIFY(initialCount > 0);
+
+    // Scroll through the list one item at a time, each step releases an item which can be
+    // reused for the one scrolled into view on the next step.
+    for (int i = 1; i <= 80; ++i) {
+        listView->setContentY(i * 20);
+        listView->forceLayout();
+    }
+
+    QVERIFY(listView->property("createdCount").toInt() <= initialCount + 2);
+    QVERIFY(listView->property("reusedCount").toInt() >= 70);
+    QVERIFY(listView->property("pooledCount").toInt() >= listView->property("reusedCount").toInt());
+
+    QVERIFY2(messageHandler.messages().isEmpty(), qPrintable(messageHandler.messageString()));
+
+    // Reused delegates are bound to the data of their new index, pooled ones are still
+    // children of the view but are hidden.
+    QQuickItem *contentItem = listView->contentItem();
+    int visible = 0;
+    int pooled = 0;
+    foreach (QQuickItem *item, contentItem->childItems()) {
+        if (item->objectName() != QLatin1String("delegate"))
+            continue;
+        QCOMPARE(item->width(), qreal(100));
+        if (!item->isVisible()) {
+            ++pooled;
+            continue;
+        }
+        if (QQuickItemPrivate::get(item)->culled)
+            continue;
+        const int index = item->property("itemIndex").toInt();
+        QVERIFY(index >= 79);
+        QCOMPARE(item->property("itemName").toString(), QString("item %1").arg(index));
+        ++visible;
+    }
+    QVERIFY(visible >= 5);
+    QVERIFY(pooled > 0);
+
+    // Once reuse is disabled released items are destroyed and new ones created.
+    visualModel->setReuseItems(false);
+    const int createdCount = listView->property("createdCount").toInt();
+    const int reusedCount = listView->property("reusedCount").toInt();
+    for (int i = 79; i >= 70; --i) {
+        listView->setContentY(i * 20);
+        listView->forceLayout();
+    }
+    QVERIFY(listView->property("createdCount").toInt() >= createdCount + 9);
+    QCOMPARE(listView->property("reusedCount").toInt(), reusedCount);
+}
+
+void tst_qquickvisualdatamodel::reuseItemsInColumn()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("reuseitemscolumn.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QQuickItem *column = view.rootObject();
+    QVERIFY(column);
+    QTRY_COMPARE(column->height(), qreal(100));
+
+    // Pooled delegates are hidden, so the column doesn't leave space for them.
+    QVERIFY(QMetaObject::invokeMethod(column, "removeItems", Q_ARG(QVariant, 1), Q_ARG(QVariant, 3)));
+    QTRY_COMPARE(column->height(), qreal(40));
+
+    QList<QQuickItem *> delegates;
+    foreach (QQuickItem *item, column->childItems()) {
+        if (item->objectName() == QLatin1String("delegate"))
+            delegates.append(item);
+    }
+    QCOMPARE(delegates.count(), 5);
+    int visible = 0;
+    foreach (QQuickItem *item, delegates) {
+        if (item->isVisible()) {
+            ++visible;
+            const QString name = item->property("itemName").toString();
+            QVERIFY(name == QLatin1String("a") || name == QLatin1String("e"));
+        }
+    }
+    QCOMPARE(visible, 2);
+
+    // Reused delegates are shown again.
+    QVERIFY(QMetaObject::invokeMethod(column, "appendItem", Q_ARG(QVariant, QLatin1String("f"))));
+    QVERIFY(QMetaObject::invokeMethod(column, "appendItem", Q_ARG(QVariant, QLatin1String("g"))));
+    QCOMPARE(column->property("reusedCount").toInt(), 2);
+    QTRY_COMPARE(column->height(), qreal(80));
+
+    visible = 0;
+    foreach (QQuickItem *item, delegates) {
+        if (item->isVisible())
+            ++visible;
+    }
+    QCOMPARE(visible, 4);
+}
+
+void tst_qquickvisualdatamodel::keyedReset()
+{
+    SingleRoleModel model(QStringList() << "a" << "b" << "c" << "d" << "e");
+
+    QQmlEngine engine;
+    engine.rootContext()->setContextProperty("myModel", &model);
+
+    QQmlComponent component(&engine, testFileUrl("keyedreset.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(visualModel);
+
+    QQmlGuard<QObject> a = visualModel->object(0);
+    QQmlGuard<QObject> d = visualModel->object(3);
+    QVERIFY(a);
+    QVERIFY(d);
+
+    QSignalSpy spy(visualModel, SIGNAL(modelUpdated(QQmlChangeSet,bool)));
+    model.resetList(QStringList() << "d" << "a" << "x" << "e");
+
+    // The reset is reported as removes, moves and inserts and the delegates are kept.
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(1).toBool(), false);
+    QQmlChangeSet changeSet = spy.at(0).at(0).value<QQmlChangeSet>();
+    QCOMPARE(changeSet.difference(), -1);
+
+    QVERIFY(a);
+    QVERIFY(d);
+    QCOMPARE(visualModel->count(), 4);
+    QCOMPARE(visualModel->indexOf(d, 0), 0);
+    QCOMPARE(visualModel->indexOf(a, 0), 1);
+    QCOMPARE(d->property("itemName").toString(), QString("d"));
+    QCOMPARE(a->property("itemName").toString(), QString("a"));
+    QCOMPARE(evaluate<QString>(visualModel, "items.get(2).model.name"), QString("x"));
+
+    // Duplicate keys can't be matched and reset the model.
+    model.resetList(QStringList() << "a" << "a" << "d");
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(spy.at(1).at(1).toBool(), true);
+
+    visualModel->release(a);
+    visualModel->release(d);
+
+    QStringList keys;
+    for (int i = 0; i < 200; ++i)
+        keys.prepend(QString::number(i));
+    model.resetList(keys);
+    QCOMPARE(spy.count(), 3);
+
+    // Reversing the order would move too many items one by one, so it resets the model.
+    keys.clear();
+    for (int i = 0; i < 200; ++i)
+        keys.append(QString::number(i));
+    model.resetList(keys);
+    QCOMPARE(spy.count(), 4);
+    QCOMPARE(spy.at(3).at(1).toBool(), true);
+
+    // Only the items which are out of order are moved.
+    keys.move(0, 199);
+    keys.move(100, 0);
+    model.resetList(keys);
+    QCOMPARE(spy.count(), 5);
+    QCOMPARE(spy.at(4).at(1).toBool(), false);
+    changeSet = spy.at(4).at(0).value<QQmlChangeSet>();
+    QCOMPARE(changeSet.difference(), 0);
+    QCOMPARE(changeSet.removes().count(), 2);
+    QCOMPARE(visualModel->count(), 200);
+    QCOMPARE(evaluate<QString>(visualModel, "items.get(0).model.name"), QString("101"));
+    QCOMPARE(evaluate<QString>(visualModel, "items.get(199).model.name"), QString("0"));
+}
+
+void tst_qquickvisualdatamodel::batchDataChanges()
+{
+    QStringList list;
+    for (int i = 0; i < 10; ++i)
+        list << QString("item %1").arg(i);
+    SingleRoleModel model(list);
+
+    QQmlEngine engine;
+    engine.rootContext()->setContextProperty("myModel", &model);
+
+    QQmlComponent component(&engine, testFileUrl("batchdatachanges.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(visualModel);
+
+    QObject *item2 = visualModel->object(2);
+    QObject *item3 = visualModel->object(3);
+    QVERIFY(item2);
+    QVERIFY(item3);
+
+    visualModel->setWatchedRoles(QList<QByteArray>() << "name");
+
+    QSignalSpy spy(visualModel, SIGNAL(modelUpdated(QQmlChangeSet,bool)));
+    for (int i = 0; i < 5; ++i) {
+        model.set(2, QString("two %1").arg(i));
+        model.set(3, QString("three %1").arg(i));
+        model.set(7, QString("seven %1").arg(i));
+    }
+
+    // Nothing is applied until control returns to the event loop.
+    QCOMPARE(spy.count(), 0);
+    QCOMPARE(item2->property("itemName").toString(), QString("item 2"));
+    // Every notification after the first joins the pending batch.
+    QCOMPARE(visualModel->coalescedDataChanges(), 14);
+    int coalesced = 0;
+    QVERIFY(QMetaObject::invokeMethod(visualModel, "coalescedDataChanges", Q_RETURN_ARG(int, coalesced)));
+    QCOMPARE(coalesced, 14);
+
+    QCoreApplication::sendPostedEvents(visualModel, 0);
+
+    QCOMPARE(spy.count(), 1);
+    QQmlChangeSet changeSet = spy.at(0).at(0).value<QQmlChangeSet>();
+    QCOMPARE(changeSet.changes().count(), 2);
+    QCOMPARE(changeSet.changes().at(0).index, 2);
+    QCOMPARE(changeSet.changes().at(0).count, 2);
+    QCOMPARE(changeSet.changes().at(1).index, 7);
+
+    QCOMPARE(item2->property("itemName").toString(), QString("two 4"));
+    QCOMPARE(item2->property("updates").toInt(), 1);
+    QCOMPARE(item3->property("itemName").toString(), QString("three 4"));
+    QCOMPARE(item3->property("updates").toInt(), 1);
+
+    // Pending changes follow the rows they belong to and are dropped with removed rows.
+    model.set(2, QString("two"));
+    model.set(5, QString("five"));
+    model.setList(QStringList() << "a" << "b");
+    QCoreApplication::sendPostedEvents(visualModel, 0);
+    QCOMPARE(spy.count(), 3);
+
+    visualModel->release(item2);
+    visualModel->release(item3);
+}
+
+void tst_qquickvisualdatamodel::pagedFetch()
+{
+    PagedModel model(1000);
+
+    QQmlEngine engine;
+    engine.rootContext()->setContextProperty("myModel", &model);
+
+    QQmlComponent component(&engine, testFileUrl("pagedfetch.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QQmlDelegateModel *visualModel = qobject_cast<QQmlDelegateModel *>(object.data());
+    QVERIFY(visualModel);
+    QCOMPARE(visualModel->pageSize(), 10);
+    QCOMPARE(visualModel->pageCacheSize(), 2);
+
+    visualModel->setWatchedRoles(QList<QByteArray>() << "name");
+
+    // Items are created with placeholder data and the pages they belong to are fetched together
+    // once control returns to the event loop.
+    QObject *item3 = visualModel->object(3);
+    QObject *item7 = visualModel->object(7);
+    QObject *item25 = visualModel->object(25);
+    QVERIFY(item3);
+    QVERIFY(item7);
+    QVERIFY(item25);
+    QCOMPARE(item3->property("itemName").toString(), QString("loading"));
+    QVERIFY(model.fetched.isEmpty());
+
+    QCoreApplication::sendPostedEvents(visualModel, 0);
+
+    QCOMPARE(model.fetched, QStringList() << "0,10" << "20,10");
+    QVERIFY(model.released.isEmpty());
+    QCOMPARE(item3->property("itemName").toString(), QString("row 3"));
+    QCOMPARE(item25->property("itemName").toString(), QString("row 25"));
+
+    // Pages which have been fetched aren't fetched again, and using them keeps them cached.
+    visualModel->release(item3);
+    item3 = visualModel->object(3);
+    QObject *item45 = visualModel->object(45);
+    QVERIFY(item45);
+    QCoreApplication::sendPostedEvents(visualModel, 0);
+
+    QCOMPARE(model.fetched, QStringList() << "0,10" << "20,10" << "40,10");
+    QCOMPARE(model.released, QStringList() << "20,10");
+
+    // The final page is clamped to the row count.
+    QObject *item995 = visualModel->object(995);
+    QVERIFY(item995);
+    QCoreApplication::sendPostedEvents(visualModel, 0);
+    QCOMPARE(model.fetched.last(), QString("990,10"));
+    QCOMPARE(model.released.last(), QString("0,10"));
+
+    // Inserting rows releases the rows of the fetched pages where they are now, and the pages
+    // of the existing items are fetched again.
+    visualModel->setPageCacheSize(8);
+    const int fetchedCount = model.fetched.count();
+    const int releasedCount = model.released.count();
+    model.insert(45, 5);
+    QCOMPARE(model.released.mid(releasedCount), QStringList() << "40,5" << "50,5" << "995,10");
+    QCOMPARE(model.fetched.count(), fetchedCount);
+
+    QCoreApplication::sendPostedEvents(visualModel, 0);
+    QCOMPARE(model.fetched.mid(fetchedCount), QStringList() << "0,10" << "20,10" << "50,10" << "1000,5");
+    QCOMPARE(item45->property("itemName").toString(), QString("row 50"));
+    QCOMPARE(item995->property("itemName").toString(), QString("row 1000"));
+
+    // New items still fetch their pages as they are created.
+    QObject *item41 = visualModel->object(41);
+    QVERIFY(item41);
+    QCoreApplication::sendPostedEvents(visualModel, 0);
+    QCOMPARE(model.fetched.mid(fetchedCount + 4), QStringList() << "40,10");
+    QCOMPARE(model.released.count(), releasedCount + 3);
+    QCOMPARE(item41->property("itemName").toString(), QString("row 41"));
+
+    // Without a page size rows aren't fetched.
+    visualModel->setPageSize(0);
+    QCOMPARE(model.released.last(), QString("40,10"));
+    QObject *item500 = visualModel->object(500);
+    QVERIFY(item500);
+    QCoreApplication::sendPostedEvents(visualModel, 0);
+    QCOMPARE(model.fetched.count(), fetchedCount + 5);
+    QCOMPARE(item500->property("itemName").toString(), QString("loading"));
+
+    visualModel->release(item3);
+    visualModel->release(item7);
+    visualModel->release(item25);
+    visualModel->release(item45);
+    visualModel->release(item995);
+    visualModel->release(item41);
+    visualModel->release(item500);
+}
+
 QTEST_MAIN(tst_qquickvisualdatamodel)
 
 #include "tst_qquickvisualdatamodel.moc"
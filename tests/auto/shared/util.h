@@ -108,4 +108,30 @@ private:
     QtMessageHandler m_oldHandler;
 };
 
+/* Sets an environment variable for its lifetime and restores the previous state afterwards. */
+
+class EnvironmentVariableGuard
+{
+    Q_DISABLE_COPY(EnvironmentVariableGuard)
+public:
+    EnvironmentVariableGuard(const char *name, const QByteArray &value)
+        : m_name(name), m_wasSet(qEnvironmentVariableIsSet(name)), m_value(qgetenv(name))
+    {
+        qputenv(name, value);
+    }
+
+    ~EnvironmentVariableGuard()
+    {
+        if (m_wasSet)
+            qputenv(m_name, m_value);
+        else
+            qunsetenv(m_name);
+    }
+
+private:
+    const char *m_name;
+    bool m_wasSet;
+    QByteArray m_value;
+};
+
 #endif // QQMLTESTUTILS_H
@@ -52,6 +52,7 @@
 #include <QFile>
 #include <QDebug>
 #include <QTextStream>
+#include <QElapsedTimer>
 
 class tst_compilation : public QObject
 {
@@ -62,6 +63,9 @@ public:
 private slots:
     void boomblock();
 
+    void lexer_data();
+    void lexer();
+
     void jsparser_data();
     void jsparser();
 
@@ -100,6 +104,53 @@ void tst_compilation::boomblock()
     }
 }
 
+void tst_compilation::lexer_data()
+{
+    QTest::addColumn<QString>("file");
+
+    const QString srcDir = QLatin1String(SRCDIR "/../../../../");
+    QTest::newRow("boomblock") << QString(SRCDIR + QLatin1String("/data/BoomBlock.qml"));
+    QTest::newRow("testcase") << QString(srcDir + QLatin1String("src/imports/testlib/TestCase.qml"));
+    QTest::newRow("tiger") << QString(srcDir + QLatin1String("examples/quick/canvas/tiger/tiger.js"));
+}
+
+void tst_compilation::lexer()
+{
+    QFETCH(QString, file);
+
+    QFile f(file);
+    if (!f.open(QIODevice::ReadOnly))
+        QSKIP("Source file not available");
+    QByteArray data = f.readAll();
+
+    QTextStream stream(data, QIODevice::ReadOnly);
+    const QString code = stream.readAll();
+    const bool qmlMode = file.endsWith(QLatin1String(".qml"));
+
+    QElapsedTimer timer;
+    qint64 iterations = 0;
+    timer.start();
+
+    QBENCHMARK {
+        QQmlJS::Engine engine;
+
+        QQmlJS::Lexer lexer(&engine);
+        lexer.setCode(code, 1, qmlMode);
+
+        int token;
+        do {
+            token = lexer.lex();
+        } while (token != QQmlJS::Lexer::EOF_SYMBOL && token != QQmlJS::Lexer::T_ERROR);
+        ++iterations;
+    }
+
+    const qint64 elapsed = timer.nsecsElapsed();
+    if (elapsed > 0) {
+        const double megabytes = double(data.size()) * iterations / (1024 * 1024);
+        qDebug("%s: %.1f MB/s", QTest::currentDataTag(), megabytes / (elapsed / 1e9));
+    }
+}
+
 void tst_compilation::jsparser_data()
 {
     QTest::addColumn<QString>("file");
@@ -8,11 +8,13 @@ SUBDIRS += \
            pointers \
            qqmlcomponent \
            qqmlimage \
+           qqmllistcompositor \
            qqmlmetaproperty \
            script \
            qmltime \
            js \
-           qquickwindow
+           qquickwindow \
+           workerscript
 
 qtHaveModule(opengl): SUBDIRS += painting
 
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TEMPLATE = app
+TARGET = tst_qqmllistcompositor
+QT += core-private qml-private testlib
+macx:CONFIG -= app_bundle
+
+SOURCES += tst_qqmllistcompositor.cpp
+
+DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0
@@ -0,0 +1,167 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <private/qqmllistcompositor_p.h>
+
+typedef QQmlListCompositor C;
+
+Q_DECLARE_METATYPE(C::Group)
+
+static const C::Group Selection = C::Group(2);
+
+class tst_qqmllistcompositor : public QObject
+{
+    Q_OBJECT
+
+    enum {
+        ItemCount = 100000,
+        MemberCount = 10000,
+        SelectionFlag = 0x04
+    };
+
+public:
+    tst_qqmllistcompositor() {}
+
+private slots:
+    void initTestCase();
+
+    void findSequential();
+    void findRandom_data();
+    void findRandom();
+    void toggleGroups();
+
+private:
+    void populate(QQmlListCompositor *compositor);
+
+    QVector<int> randomIndexes(int count, int range) const;
+
+    int m_list;
+};
+
+void tst_qqmllistcompositor::initTestCase()
+{
+    qsrand(32);
+}
+
+// 100k items where every 10th item is also in the selection group, giving about 20k ranges.
+void tst_qqmllistcompositor::populate(QQmlListCompositor *compositor)
+{
+    compositor->setGroupCount(3);
+    compositor->append(&m_list, 0, ItemCount, C::PrependFlag | C::DefaultFlag);
+    for (int i = 0; i < MemberCount; ++i)
+        compositor->setFlags(C::Default, i * (ItemCount / MemberCount), 1, SelectionFlag);
+}
+
+QVector<int> tst_qqmllistcompositor::randomIndexes(int count, int range) const
+{
+    QVector<int> indexes(count);
+    for (int i = 0; i < count; ++i)
+        indexes[i] = qrand() % range;
+    return indexes;
+}
+
+void tst_qqmllistcompositor::findSequential()
+{
+    QQmlListCompositor compositor;
+    populate(&compositor);
+
+    int sum = 0;
+    QBENCHMARK {
+        for (int i = 0; i < ItemCount; ++i)
+            sum += compositor.find(C::Default, i).modelIndex();
+    }
+    Q_UNUSED(sum);
+}
+
+void tst_qqmllistcompositor::findRandom_data()
+{
+    QTest::addColumn<C::Group>("group");
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("default") << C::Default << int(ItemCount);
+    QTest::newRow("selection") << Selection << int(MemberCount);
+}
+
+void tst_qqmllistcompositor::findRandom()
+{
+    QFETCH(C::Group, group);
+    QFETCH(int, count);
+
+    QQmlListCompositor compositor;
+    populate(&compositor);
+
+    const QVector<int> indexes = randomIndexes(10000, count);
+
+    int sum = 0;
+    QBENCHMARK {
+        foreach (int index, indexes)
+            sum += compositor.find(group, index).modelIndex();
+    }
+    Q_UNUSED(sum);
+}
+
+void tst_qqmllistcompositor::toggleGroups()
+{
+    QQmlListCompositor compositor;
+    populate(&compositor);
+
+    // Alternate between changing a membership and looking up items at random positions, which
+    // is the pattern of a filtered DelegateModel being updated while a view reads from it.
+    const QVector<int> toggles = randomIndexes(1000, ItemCount);
+    const QVector<int> lookups = randomIndexes(1000 * 8, ItemCount);
+
+    QBENCHMARK {
+        for (int i = 0; i < toggles.count(); ++i) {
+            C::iterator it = compositor.find(C::Default, toggles.at(i));
+            if (it->inGroup(Selection))
+                compositor.clearFlags(it, 1, SelectionFlag);
+            else
+                compositor.setFlags(it, 1, SelectionFlag);
+            for (int j = 0; j < 8; ++j)
+                compositor.find(C::Default, lookups.at(i * 8 + j));
+        }
+    }
+}
+
+QTEST_MAIN(tst_qqmllistcompositor)
+
+#include "tst_qqmllistcompositor.moc"
@@ -0,0 +1,3 @@
+WorkerScript.onMessage = function(message) {
+    WorkerScript.sendMessage(message)
+}
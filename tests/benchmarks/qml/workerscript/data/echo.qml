@@ -0,0 +1,44 @@
+import QtQuick 2.0
+
+WorkerScript {
+    id: worker
+    source: "echo.js"
+
+    property var payload
+
+    signal done()
+
+    function makeString(count) {
+        var s = "x"
+        while (s.length < count)
+            s += s
+        payload = s.substring(0, count)
+    }
+
+    function makeNumbers(count) {
+        var a = new Array(count)
+        for (var i = 0; i < count; ++i)
+            a[i] = i + 0.5
+        payload = a
+    }
+
+    function makeMixed(count) {
+        var a = new Array(count)
+        for (var i = 0; i < count; ++i)
+            a[i] = (i % 2) ? i : "item"
+        payload = a
+    }
+
+    function makeObjects(count) {
+        var a = new Array(count)
+        for (var i = 0; i < count; ++i)
+            a[i] = { index: i, value: i + 0.5, name: "item" }
+        payload = a
+    }
+
+    function send() {
+        worker.sendMessage(payload)
+    }
+
+    onMessage: worker.done()
+}
@@ -0,0 +1,114 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QQmlEngine>
+#include <QQmlComponent>
+#include <QEventLoop>
+#include <QTimer>
+
+class tst_workerscript : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_workerscript() {}
+
+private slots:
+    void roundTrip_data();
+    void roundTrip();
+
+private:
+    bool waitForEcho(QObject *worker);
+
+    QQmlEngine engine;
+};
+
+bool tst_workerscript::waitForEcho(QObject *worker)
+{
+    QEventLoop loop;
+    connect(worker, SIGNAL(done()), &loop, SLOT(quit()));
+    QTimer timer;
+    timer.setSingleShot(true);
+    connect(&timer, SIGNAL(timeout()), &loop, SLOT(quit()));
+    timer.start(10000);
+    loop.exec();
+    return timer.isActive();
+}
+
+void tst_workerscript::roundTrip_data()
+{
+    QTest::addColumn<QByteArray>("factory");
+    QTest::addColumn<int>("count");
+
+    // Each payload is about 1MB in its serialized form
+    QTest::newRow("string") << QByteArray("makeString") << 512 * 1024;
+    QTest::newRow("number array") << QByteArray("makeNumbers") << 128 * 1024;
+    QTest::newRow("mixed array") << QByteArray("makeMixed") << 64 * 1024;
+    QTest::newRow("object array") << QByteArray("makeObjects") << 16 * 1024;
+}
+
+void tst_workerscript::roundTrip()
+{
+    QFETCH(QByteArray, factory);
+    QFETCH(int, count);
+
+    QQmlComponent component(&engine, QUrl::fromLocalFile(SRCDIR "/data/echo.qml"));
+    QObject *worker = component.create();
+    QVERIFY(worker != 0);
+
+    QVERIFY(QMetaObject::invokeMethod(worker, factory.constData(), Q_ARG(QVariant, count)));
+
+    // Make sure the script is loaded before measuring
+    QVERIFY(QMetaObject::invokeMethod(worker, "send"));
+    QVERIFY(waitForEcho(worker));
+
+    QBENCHMARK {
+        QMetaObject::invokeMethod(worker, "send");
+        waitForEcho(worker);
+    }
+
+    delete worker;
+}
+
+QTEST_MAIN(tst_workerscript)
+
+#include "tst_workerscript.moc"
@@ -0,0 +1,13 @@
+CONFIG += testcase
+TEMPLATE = app
+TARGET = tst_workerscript
+QT += qml testlib
+macx:CONFIG -= app_bundle
+
+SOURCES += tst_workerscript.cpp
+
+OTHER_FILES += data/echo.qml data/echo.js
+
+# Define SRCDIR equal to test's source directory
+DEFINES += SRCDIR=\\\"$$PWD\\\"
+DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0
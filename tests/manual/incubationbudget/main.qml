@@ -0,0 +1,44 @@
+import QtQuick 2.0
+
+Rectangle {
+    width: 640
+    height: 480
+
+    Rectangle {
+        id: mover
+        width: 40
+        height: 40
+        color: "steelblue"
+
+        NumberAnimation on x {
+            from: 0
+            to: 600
+            duration: 2000
+            loops: Animation.Infinite
+        }
+    }
+
+    Loader {
+        anchors.fill: parent
+        anchors.topMargin: 50
+        asynchronous: true
+
+        sourceComponent: Grid {
+            columns: 40
+
+            Repeater {
+                model: 2000
+                delegate: Rectangle {
+                    width: 16
+                    height: 8
+                    color: Qt.rgba(index % 40 / 40, 0.5, 1 - index / 2000, 1)
+
+                    Text {
+                        text: index
+                        font.pixelSize: 6
+                    }
+                }
+            }
+        }
+    }
+}